@@ -137,6 +137,16 @@ TH1* AliCFContainer::Project(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3)
   return fGrid[istep]->Project(ivar1,ivar2,ivar3);
 }
 
+//____________________________________________________________________
+void AliCFContainer::SetDenseFillBuffer(Long64_t maxCells)
+{
+  //
+  // Enables the dense fill buffer of the grids of all the steps,
+  // see AliCFGridSparse::SetDenseFillBuffer()
+  //
+  for (Int_t iStep=0; iStep<fNStep; iStep++) fGrid[iStep]->SetDenseFillBuffer(maxCells);
+}
+
 //____________________________________________________________________
 AliCFContainer* AliCFContainer::MakeSlice(Int_t nVars, const Int_t* vars, const Double_t* varMin, const Double_t* varMax, Bool_t useBins) const
 {
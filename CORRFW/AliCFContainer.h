@@ -62,6 +62,7 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  SetDenseFillBuffer(Long64_t maxCells) ; // dense fill buffer for the grids of at most maxCells cells
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
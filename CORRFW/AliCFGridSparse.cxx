@@ -33,6 +33,7 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TAxis.h"
+#include "TBuffer.h"
 #include "AliCFUnfolding.h"
 
 //____________________________________________________________________
@@ -42,7 +43,15 @@ ClassImp(AliCFGridSparse)
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseMaxCells(0),
+  fDenseStatus(0),
+  fDenseStride(),
+  fDenseContent(),
+  fDenseSumw2(),
+  fDenseUsed(),
+  fDenseFilled(),
+  fDenseEntries(0.)
 {
   // default constructor
 }
@@ -50,7 +59,15 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseMaxCells(0),
+  fDenseStatus(0),
+  fDenseStride(),
+  fDenseContent(),
+  fDenseSumw2(),
+  fDenseUsed(),
+  fDenseFilled(),
+  fDenseEntries(0.)
 {
   // default constructor
 }
@@ -58,7 +75,15 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseMaxCells(0),
+  fDenseStatus(0),
+  fDenseStride(),
+  fDenseContent(),
+  fDenseSumw2(),
+  fDenseUsed(),
+  fDenseFilled(),
+  fDenseEntries(0.)
 {
   //
   // main constructor
@@ -80,7 +105,15 @@ AliCFGridSparse::~AliCFGridSparse()
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseMaxCells(0),
+  fDenseStatus(0),
+  fDenseStride(),
+  fDenseContent(),
+  fDenseSumw2(),
+  fDenseUsed(),
+  fDenseFilled(),
+  fDenseEntries(0.)
 {
   //
   // copy constructor
@@ -104,6 +137,8 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, Double_t min, Double_t max)
   //
   // set a uniform binning for variable ivar
   //
+  FlushDenseBuffer();
+  ResetDenseBuffer();
   Int_t nBins = GetNBins(ivar);
   Double_t * array = new Double_t[nBins+1];
   for (Int_t iEdge=0; iEdge<=nBins; iEdge++) array[iEdge] = min + iEdge * (max-min)/nBins ;
@@ -117,6 +152,8 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, const Double_t *array)
   //
   // setting the arrays containing the bin limits 
   //
+  FlushDenseBuffer();
+  ResetDenseBuffer();
   fData->SetBinEdges(ivar, array);
 } 
 
@@ -127,8 +164,118 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   // Fill the grid,
   // given a set of values of the input variable, 
   // with weight (by default w=1)
+  // If the dense fill buffer is enabled, the weight is accumulated in the
+  // buffer and moved to the THnSparse at the next access to the grid
   //
-  fData->Fill(var,weight);
+  if (fDenseStatus==0) InitDenseBuffer();
+  if (fDenseStatus<0) {
+    fData->Fill(var,weight);
+    return;
+  }
+
+  Long64_t cell = 0;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) cell += fData->GetAxis(iVar)->FindBin(var[iVar]) * fDenseStride[iVar];
+  if (!fDenseUsed[cell]) {
+    fDenseUsed[cell] = 1;
+    fDenseFilled.push_back(cell);
+  }
+  fDenseContent[cell] += weight;
+  if (fData->GetCalculateErrors()) fDenseSumw2[cell] += weight*weight;
+  fDenseEntries += 1.;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SetDenseFillBuffer(Long64_t maxCells)
+{
+  //
+  // Accumulate the fills in dense arrays (under/overflows included)
+  // instead of looking up the THnSparse hash table at each fill,
+  // if the grid has at most maxCells cells. maxCells=0 disables the buffer.
+  // The memory used is 17 bytes per cell.
+  //
+  FlushDenseBuffer();
+  ResetDenseBuffer();
+  fDenseMaxCells = maxCells;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::InitDenseBuffer()
+{
+  //
+  // allocate the dense fill buffer if the grid is small enough
+  //
+  fDenseStatus = -1;
+  if (fDenseMaxCells<=0 || !fData) return;
+
+  Int_t nVar = GetNVar();
+  std::vector<Long64_t> stride(nVar);
+  Long64_t nCells = 1;
+  for (Int_t iVar=0; iVar<nVar; iVar++) {
+    stride[iVar] = nCells;
+    nCells *= GetNBins(iVar)+2;
+    if (nCells>fDenseMaxCells) {
+      AliInfo(Form("Grid has more than %lld cells, dense fill buffer not used",fDenseMaxCells));
+      return;
+    }
+  }
+
+  fDenseStride.swap(stride);
+  fDenseContent.assign(nCells,0.);
+  fDenseSumw2.assign(nCells,0.);
+  fDenseUsed.assign(nCells,0);
+  fDenseFilled.clear();
+  fDenseEntries = 0.;
+  fDenseStatus = 1;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ResetDenseBuffer()
+{
+  //
+  // drop the dense fill buffer, it is allocated again at the next fill
+  //
+  fDenseStatus = 0;
+  std::vector<Long64_t>().swap(fDenseStride);
+  std::vector<Double_t>().swap(fDenseContent);
+  std::vector<Double_t>().swap(fDenseSumw2);
+  std::vector<UChar_t>().swap(fDenseUsed);
+  std::vector<Long64_t>().swap(fDenseFilled);
+  fDenseEntries = 0.;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushDenseBuffer() const
+{
+  //
+  // Add the content of the dense fill buffer to the THnSparse.
+  // Bins are created in order of first fill, as with direct fills.
+  //
+  if (fDenseFilled.empty()) return;
+
+  Int_t nVar = GetNVar();
+  Int_t* bin = new Int_t[nVar];
+  Double_t entries = fData->GetEntries();
+  Bool_t errors = fData->GetCalculateErrors();
+
+  for (UInt_t i=0; i<fDenseFilled.size(); i++) {
+    Long64_t cell = fDenseFilled[i];
+    Long64_t rest = cell;
+    for (Int_t iVar=nVar-1; iVar>=0; iVar--) {
+      bin[iVar] = rest / fDenseStride[iVar];
+      rest -= bin[iVar] * fDenseStride[iVar];
+    }
+    Long64_t index = fData->GetBin(bin,kTRUE);
+    fData->SetBinContent(index, fData->GetBinContent(index) + fDenseContent[cell]);
+    if (errors) fData->SetBinError2(index, fData->GetBinError2(index) + fDenseSumw2[cell]);
+    fDenseContent[cell] = 0.;
+    fDenseSumw2[cell] = 0.;
+    fDenseUsed[cell] = 0;
+  }
+  fData->SetEntries(entries + fDenseEntries);
+
+  fDenseFilled.clear();
+  fDenseEntries = 0.;
+  delete [] bin;
 }
 
 //___________________________________________________________________
@@ -139,6 +286,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   // axis ranges can be defined in arrays varMin, varMax
   // If useBins=true, varMin and varMax are taken as bin numbers
   //
+  FlushDenseBuffer();
 
   // binning for new grid
   Int_t* bins = new Int_t[nVars];
@@ -191,7 +339,7 @@ Float_t AliCFGridSparse::GetEntries() const
   //
   // total entries (including overflows and underflows)
   //
-
+  FlushDenseBuffer();
   return fData->GetEntries();
 }
 
@@ -201,7 +349,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   //
   // Returns content of grid element index 
   //
-  
+  FlushDenseBuffer();  
   return fData->GetBinContent(index);
 }
 //____________________________________________________________________
@@ -210,6 +358,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
+  FlushDenseBuffer();
   return fData->GetBinContent(bin);
 
 }  
@@ -219,7 +368,7 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   //
   // Get the content in a bin corresponding to a set of input variables
   //
-
+  FlushDenseBuffer();
   Long_t index = fData->GetBin(var,kFALSE);
   if (index<0) return 0.;
   return fData->GetBinContent(index);
@@ -231,7 +380,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   //
   // Returns the error on the content 
   //
-
+  FlushDenseBuffer();
   return fData->GetBinError(index);
 }
 //____________________________________________________________________
@@ -240,6 +389,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
+  FlushDenseBuffer();
   return fData->GetBinError(bin);
 
 }  
@@ -249,7 +399,7 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   //
   // Get the error in a bin corresponding to a set of input variables
   //
-
+  FlushDenseBuffer();
   Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
   return fData->GetBinError(index);
@@ -261,6 +411,7 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
   //
   // Sets grid element value
   //
+  FlushDenseBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
@@ -273,6 +424,7 @@ void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
   //
   // Sets grid element of bin indeces bin to val
   //
+  FlushDenseBuffer();
   fData->SetBinContent(bin,val);
 }
 //____________________________________________________________________
@@ -281,6 +433,7 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
+  FlushDenseBuffer();
   Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -294,6 +447,7 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
   //
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
+  FlushDenseBuffer();
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin);
   SetElementError(bin,val);
@@ -306,6 +460,7 @@ void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
   //
   // Sets grid element error of bin indeces bin to val
   //
+  FlushDenseBuffer();
   fData->SetBinError(bin,val);
 }
 //____________________________________________________________________
@@ -314,6 +469,7 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
+  FlushDenseBuffer();
   Long_t index=fData->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
   fData->GetBinContent(index,bin); //trick to access the array of bins
@@ -327,6 +483,7 @@ void AliCFGridSparse::SumW2()
   //
   //set calculation of the squared sum of the weighted entries
   //
+  FlushDenseBuffer();
   if(!fSumW2){
     fData->CalculateErrors(kTRUE); 
   }
@@ -340,6 +497,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   //add aGrid to the current one
   //
 
+  FlushDenseBuffer();
   if (aGrid->GetNVar() != GetNVar()){
     AliError("Different number of variables, cannot add the grids");
     return;
@@ -356,6 +514,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   //Add aGrid1 and aGrid2 and deposit the result into the current one
   //
 
+  FlushDenseBuffer();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliInfo("Different number of variables, cannot add the grids");
     return;
@@ -375,6 +534,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   // Multiply aGrid to the current one
   //
 
+  FlushDenseBuffer();
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
     return;
@@ -393,6 +553,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   //Multiply aGrid1 and aGrid2 and deposit the result into the current one
   //
 
+  FlushDenseBuffer();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot multiply the grids");
     return;
@@ -415,6 +576,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   // Divide aGrid to the current one
   //
 
+  FlushDenseBuffer();
   if (aGrid->GetNVar() != GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
     return;
@@ -436,6 +598,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
   //binomial errors are supported
   //
 
+  FlushDenseBuffer();
   if (GetNVar() != aGrid1->GetNVar() || GetNVar() != aGrid2->GetNVar()) {
     AliError("Different number of variables, cannot divide the grids");
     return;
@@ -457,6 +620,8 @@ void AliCFGridSparse::Rebin(const Int_t* group)
   // Please notice that the original number of bins on
   // a given axis has to be divisible by the rebin group.
   //
+  FlushDenseBuffer();
+  ResetDenseBuffer();
 
   for(Int_t i=0;i<GetNVar();i++){
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
@@ -553,6 +718,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
+  FlushDenseBuffer();
   return fData->ComputeIntegral();  
 } 
 
@@ -606,6 +772,9 @@ void AliCFGridSparse::Copy(TObject& c) const
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
   target.fSumW2 = fSumW2 ;
+  target.fDenseMaxCells = fDenseMaxCells ;
+  target.ResetDenseBuffer();
+  FlushDenseBuffer();
   if (fData) {
     target.fData = (THnSparse*)fData->Clone();
   }
@@ -621,6 +790,7 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
 
+  FlushDenseBuffer();
   THnSparse* clone = (THnSparse*)fData->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
@@ -746,6 +916,7 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   // Returns overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushDenseBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
@@ -772,6 +943,7 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   // Returns exclusive overflows in variable ivar
   // Set 'exclusive' to true for an exclusive check on variable ivar
   //
+  FlushDenseBuffer();
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
@@ -798,8 +970,26 @@ void AliCFGridSparse::Smooth() {
   // smoothing function: TO USE WITH CARE
   //
 
+  FlushDenseBuffer();
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
   AliInfo(Form("N FILLED BINS : %li",GetNFilledBins()));
   AliCFUnfolding::SmoothUsingNeighbours(fData);
 }
+
+//____________________________________________________________________
+void AliCFGridSparse::Streamer(TBuffer &R__b)
+{
+  //
+  // Stream an object of class AliCFGridSparse,
+  // the dense fill buffer is flushed before writing
+  //
+  if (R__b.IsReading()) {
+    ResetDenseBuffer();
+    R__b.ReadClassBuffer(AliCFGridSparse::Class(),this);
+  }
+  else {
+    FlushDenseBuffer();
+    R__b.WriteClassBuffer(AliCFGridSparse::Class(),this);
+  }
+}
@@ -12,6 +12,7 @@
 #include "THnSparse.h"
 #include "AliLog.h"
 #include "TAxis.h"
+#include <vector>
 
 class TH1D;
 class TH2D;
@@ -37,7 +38,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {FlushDenseBuffer(); return fData->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -56,6 +57,9 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  virtual void    SetDenseFillBuffer(Long64_t maxCells);   // buffer the fills in dense arrays if the grid has at most maxCells cells
+  Long64_t        GetDenseFillBuffer() const {return fDenseMaxCells;}
+  void            FlushDenseBuffer() const;                // move the buffered fills to the THnSparse
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -99,8 +103,8 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  virtual void     SetGrid(THnSparse* grid) {ResetDenseBuffer(); if (fData) delete fData ; fData=grid;}
+  THnSparse   *    GetGrid() const {FlushDenseBuffer(); return fData;}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,12 +122,23 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  void     InitDenseBuffer();
+  void     ResetDenseBuffer();
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
+  Long64_t    fDenseMaxCells ; // Max number of cells (under/overflows included) for the dense fill buffer, 0 = no buffer
 
-  ClassDef(AliCFGridSparse,3);
+  Int_t                         fDenseStatus  ; //! Dense buffer status: 0 = to be initialised, 1 = in use, -1 = not used
+  std::vector<Long64_t>         fDenseStride  ; //! Stride of the cell index along each variable
+  mutable std::vector<Double_t> fDenseContent ; //! Buffered sum of weights per cell
+  mutable std::vector<Double_t> fDenseSumw2   ; //! Buffered sum of squared weights per cell
+  mutable std::vector<UChar_t>  fDenseUsed    ; //! Flag set for the cells filled since the last flush
+  mutable std::vector<Long64_t> fDenseFilled  ; //! Cells filled since the last flush, in order of first fill
+  mutable Double_t              fDenseEntries ; //! Number of fills since the last flush
+
+  ClassDef(AliCFGridSparse,4);
 };
 
 
@@ -21,6 +21,7 @@
 // efficiency calculation.
 // prototype version by S.Arcelli silvia.arcelli@cern.ch
 ///////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
 
@@ -39,6 +40,7 @@ AliCFManager::AliCFManager() :
   //
   // ctor
   //
+  ResetCache();
 }
 //_____________________________________________________________________________
 AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) : 
@@ -53,6 +55,7 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
    //
    // ctor
    //
+   ResetCache();
 }
 //_____________________________________________________________________________
 AliCFManager::AliCFManager(const AliCFManager& c) : 
@@ -67,6 +70,7 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
    //
    //copy ctor
    //
+   ResetCache();
 }
 //_____________________________________________________________________________
 AliCFManager& AliCFManager::operator=(const AliCFManager& c)
@@ -84,6 +88,7 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  ResetCache();
   return *this ;
 }
 
@@ -105,11 +110,11 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
+  Bool_t allCuts=selcuts.Contains("all");
   TObjArrayIter iter(fPartCutList[isel]);
   AliCFCutBase *cut = 0;
   while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
+    Bool_t checkCut=allCuts || CompareStrings(cut->GetName(),selcuts);
     if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
   }
   return kTRUE;
@@ -126,11 +131,11 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
+  Bool_t allCuts=selcuts.Contains("all");
   TObjArrayIter iter(fEvtCutList[isel]);
   AliCFCutBase *cut = 0;
   while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
+    Bool_t checkCut=allCuts || CompareStrings(cut->GetName(),selcuts);
     if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
   }
   return kTRUE;
@@ -243,6 +248,7 @@ void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fEvtCutList[isel] = array;
+  fCutsIndexed[kEvtLevel] = kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -267,4 +273,109 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  fCutsIndexed[kPartLevel] = kFALSE;
+}
+
+//_____________________________________________________________________________
+void AliCFManager::ResetCache() {
+  //
+  // forget the cut indexing and the cached cut results
+  //
+  for (Int_t level=0; level<kNLevels; level++) {
+    fCuts[level].clear();
+    fStepCuts[level].clear();
+    fCutsIndexed[level]   = kFALSE;
+    fCurrentObject[level] = 0x0;
+    fCutsEvaluated[level] = 0;
+    fCutsPassed[level]    = 0;
+  }
+}
+
+//_____________________________________________________________________________
+void AliCFManager::IndexCuts(Int_t level) {
+  //
+  // lists the distinct cuts of all the selection steps of the given level,
+  // and for each step the indices of its cuts
+  //
+  TObjArray **cutList = (level==kPartLevel ? fPartCutList : fEvtCutList);
+  Int_t nstep = (level==kPartLevel ? fNStepPart : fNStepEvt);
+
+  fCuts[level].clear();
+  fStepCuts[level].assign(nstep,std::vector<Int_t>());
+  for (Int_t isel=0; isel<nstep; isel++) {
+    if (!cutList || !cutList[isel]) continue;
+    TObjArrayIter iter(cutList[isel]);
+    AliCFCutBase *cut = 0;
+    while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+      Int_t icut = std::find(fCuts[level].begin(),fCuts[level].end(),cut) - fCuts[level].begin();
+      if (icut == (Int_t)fCuts[level].size()) fCuts[level].push_back(cut);
+      fStepCuts[level][isel].push_back(icut);
+    }
+  }
+  if ((Int_t)fCuts[level].size() > fgkMaxCachedCuts)
+    AliWarning(Form("%d distinct cuts, more than %d: cut results will not be cached",(Int_t)fCuts[level].size(),fgkMaxCachedCuts));
+  fCutsIndexed[level] = kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliCFManager::SetCurrentObject(Int_t level, TObject *obj) {
+  //
+  // sets the event/particle checked by the cached cut checkers,
+  // the cut results of the previous one are forgotten
+  //
+  fCurrentObject[level] = obj;
+  fCutsEvaluated[level] = 0;
+  fCutsPassed[level]    = 0;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckCurrentStep(Int_t level, Int_t isel) {
+  //
+  // check whether the current object passes selection isel of the given level,
+  // each cut being evaluated at most once per object
+  //
+  Int_t nstep = (level==kPartLevel ? fNStepPart : fNStepEvt);
+  if (isel>=nstep) {
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,nstep));
+    return kTRUE;
+  }
+  TObject *obj = fCurrentObject[level];
+  if (!obj) {
+    AliError("No current object, SetCurrentEvent/SetCurrentParticle should be called first");
+    return kFALSE;
+  }
+  if (!fCutsIndexed[level]) IndexCuts(level);
+  if ((Int_t)fCuts[level].size() > fgkMaxCachedCuts) 
+    return (level==kPartLevel ? CheckParticleCuts(isel,obj) : CheckEventCuts(isel,obj));
+
+  const std::vector<Int_t> &stepCuts = fStepCuts[level][isel];
+  for (UInt_t i=0; i<stepCuts.size(); i++) {
+    ULong64_t bit = 1ULL << stepCuts[i];
+    if (!(fCutsEvaluated[level] & bit)) {
+      fCutsEvaluated[level] |= bit;
+      if (fCuts[level][stepCuts[i]]->IsSelected(obj)) fCutsPassed[level] |= bit;
+    }
+    if (!(fCutsPassed[level] & bit)) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Int_t AliCFManager::FillSteps(Int_t level, const Double_t *var, Double_t weight) {
+  //
+  // fills the container of the given level at steps 0,1,... as long as
+  // the current object passes the selection of the step
+  //
+  AliCFContainer *container = (level==kPartLevel ? fPartContainer : fEvtContainer);
+  if (!container) {
+    AliError("No container defined");
+    return 0;
+  }
+  Int_t nstep = (level==kPartLevel ? fNStepPart : fNStepEvt);
+  Int_t isel = 0;
+  for (; isel<nstep; isel++) {
+    if (!CheckCurrentStep(level,isel)) break;
+    container->Fill(var,isel,weight);
+  }
+  return isel;
 }
@@ -24,10 +24,13 @@
 // now the number of steps are fixed by the particle/event containers themselves.
 //
 
+#include <vector>
 #include "TNamed.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class AliCFCutBase;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -78,8 +81,8 @@ class AliCFManager : public TNamed
   }
   
   //Set the number of steps (already done if you have defined your containers)
-  virtual void SetNStepEvent   (Int_t nstep) {fNStepEvt  = nstep;}
-  virtual void SetNStepParticle(Int_t nstep) {fNStepPart = nstep;}
+  virtual void SetNStepEvent   (Int_t nstep) {fNStepEvt  = nstep; fCutsIndexed[kEvtLevel]  = kFALSE;}
+  virtual void SetNStepParticle(Int_t nstep) {fNStepPart = nstep; fCutsIndexed[kPartLevel] = kFALSE;}
 
   //Setter for event-level selection cut list at selection step isel
   virtual void SetEventCutsList(Int_t isel, TObjArray* array) ;
@@ -116,6 +119,19 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Cached cut checkers: each cut (possibly shared by several steps) is evaluated
+  //at most once for the current event/particle, the results are kept in a bitmask.
+  //The cut lists must be complete before the first call.
+  virtual void   SetCurrentEvent   (TObject *obj) {SetCurrentObject(kEvtLevel, obj);}
+  virtual void   SetCurrentParticle(TObject *obj) {SetCurrentObject(kPartLevel,obj);}
+  virtual Bool_t CheckCurrentEventStep   (Int_t isel) {return CheckCurrentStep(kEvtLevel, isel);}
+  virtual Bool_t CheckCurrentParticleStep(Int_t isel) {return CheckCurrentStep(kPartLevel,isel);}
+
+  //Fill the container at the successive steps passed by the current event/particle,
+  //starting from step 0, returns the number of steps filled
+  virtual Int_t  FillEventSteps   (const Double_t *var, Double_t weight=1.) {return FillSteps(kEvtLevel, var,weight);}
+  virtual Int_t  FillParticleSteps(const Double_t *var, Double_t weight=1.) {return FillSteps(kPartLevel,var,weight);}
+
  private:
   
   //number of steps
@@ -132,7 +148,24 @@ class AliCFManager : public TNamed
 
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
 
-  ClassDef(AliCFManager,2);
+  //cut results caching
+  enum {kEvtLevel=0, kPartLevel, kNLevels};
+  static const Int_t fgkMaxCachedCuts = 64; // max number of distinct cuts per level for the caching
+
+  std::vector<AliCFCutBase*>       fCuts[kNLevels];          //! distinct cuts of all the steps
+  std::vector<std::vector<Int_t> > fStepCuts[kNLevels];      //! indices in fCuts of the cuts of each step
+  Bool_t                           fCutsIndexed[kNLevels];   //! fCuts and fStepCuts are built
+  TObject                         *fCurrentObject[kNLevels]; //! object the cached results belong to
+  ULong64_t                        fCutsEvaluated[kNLevels]; //! bit i set if cut i has been evaluated
+  ULong64_t                        fCutsPassed[kNLevels];    //! bit i set if cut i is passed
+
+  void   ResetCache();
+  void   IndexCuts(Int_t level);
+  void   SetCurrentObject(Int_t level, TObject *obj);
+  Bool_t CheckCurrentStep(Int_t level, Int_t isel);
+  Int_t  FillSteps(Int_t level, const Double_t *var, Double_t weight);
+
+  ClassDef(AliCFManager,3);
 };
 
 
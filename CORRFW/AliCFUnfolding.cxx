@@ -57,6 +57,11 @@
 // found in AliCFUnfolding::CalculateCorrelatedErrors()                //
 // Author: marta.verweij@cern.ch                                       //
 //                                                                     //
+// The response matrix is converted once into flat arrays (one entry  //
+// per response bin with the indices of its measured and true cells)   //
+// on which the bayes iterations are performed, see                    //
+// AliCFUnfolding::CreateFlatResponse()                                //
+//                                                                     //
 // An optional possibility is to smooth the unfolded spectrum at the   //
 // end of each iteration, either using a fit function                  //
 // (only if #dimensions <=3)                                           //
@@ -92,6 +97,7 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <map>
 
 
 ClassImp(AliCFUnfolding)
@@ -130,7 +136,22 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNFlatM(0),
+  fNFlatT(0),
+  fFlatM(),
+  fFlatT(),
+  fFlatCond(),
+  fFlatInv(),
+  fFlatInvBin(),
+  fFlatCoordM(),
+  fFlatCoordT(),
+  fFlatPriorEff(),
+  fFlatEff(),
+  fFlatMeasured(),
+  fFlatValuesM(),
+  fFlatValuesT(),
+  fFlatFilled()
 {
   //
   // default constructor
@@ -174,7 +195,22 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNFlatM(0),
+  fNFlatT(0),
+  fFlatM(),
+  fFlatT(),
+  fFlatCond(),
+  fFlatInv(),
+  fFlatInvBin(),
+  fFlatCoordM(),
+  fFlatCoordT(),
+  fFlatPriorEff(),
+  fFlatEff(),
+  fFlatMeasured(),
+  fFlatValuesM(),
+  fFlatValuesT(),
+  fFlatFilled()
 {
   //
   // named constructor
@@ -274,6 +310,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
+  // flat arrays used in the bayes iterations
+  CreateFlatResponse();
 
 }
 
@@ -295,22 +333,25 @@ void AliCFUnfolding::CreateEstMeasured() {
   // clean the measured estimate spectrum
   fMeasuredEstimate->Reset();
 
-  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
-  priorTimesEff->Multiply(fEfficiency);
+  // prior times efficiency, in the true cells of the response
+  for (Int_t iT=0; iT<fNFlatT; iT++) {
+    const Int_t* coord = &fFlatCoordT[iT*fNVariables];
+    fFlatPriorEff[iT] = fPrior->GetBinContent(coord) * fEfficiency->GetBinContent(coord);
+  }
 
   // fill it
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t priorTimesEffValue = priorTimesEff->GetBinContent(fCoordinatesN_T);
-    Double_t fill = conditionalValue * priorTimesEffValue ;
-    
+  fFlatValuesM.assign(fNFlatM,0.);
+  fFlatFilled.clear();
+  const Long_t nBins = fFlatCond.size();
+  for (Long_t iBin=0; iBin<nBins; iBin++) {
+    Double_t fill = fFlatCond[iBin] * fFlatPriorEff[fFlatT[iBin]] ;
     if (fill>0.) {
-      fMeasuredEstimate->AddBinContent(fCoordinatesN_M,fill);
-      fMeasuredEstimate->SetBinError(fCoordinatesN_M,0.);
+      Int_t iM = fFlatM[iBin];
+      if (fFlatValuesM[iM]==0.) fFlatFilled.push_back(iM);
+      fFlatValuesM[iM] += fill;
     }
   }
-  delete priorTimesEff ;
+  FillFromFlat(fMeasuredEstimate,fFlatCoordM,fFlatValuesM);
 }
 
 //______________________________________________________________
@@ -324,21 +365,18 @@ void AliCFUnfolding::CreateInvResponse() {
   // --> INV(i,j) = COND(i,j) * T(j) * E(j)   / SUM_k { COND(i,k) * T(k) }
   //
 
-  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
-  priorTimesEff->Multiply(fEfficiency);
-
-  for (Long_t iBin=0; iBin<fConditional->GetNbins(); iBin++) {
-    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t estMeasuredValue   = fMeasuredEstimate->GetBinContent(fCoordinatesN_M);
-    Double_t priorTimesEffValue = priorTimesEff    ->GetBinContent(fCoordinatesN_T);
-    Double_t fill = (estMeasuredValue>0. ? conditionalValue * priorTimesEffValue / estMeasuredValue : 0. ) ;
-    if (fill>0. || fInverseResponse->GetBinContent(fCoordinates2N)>0.) {
-      fInverseResponse->SetBinContent(fCoordinates2N,fill);
-      fInverseResponse->SetBinError  (fCoordinates2N,0.);
+  // uses the prior times efficiency and the measured estimate of CreateEstMeasured()
+  const Long_t nBins = fFlatCond.size();
+  for (Long_t iBin=0; iBin<nBins; iBin++) {
+    Double_t estMeasuredValue   = fFlatValuesM [fFlatM[iBin]];
+    Double_t priorTimesEffValue = fFlatPriorEff[fFlatT[iBin]];
+    Double_t fill = (estMeasuredValue>0. ? fFlatCond[iBin] * priorTimesEffValue / estMeasuredValue : 0. ) ;
+    if (fill>0. || fFlatInv[iBin]>0.) {
+      fFlatInv[iBin] = fill;
+      fInverseResponse->SetBinContent(fFlatInvBin[iBin],fill);
+      fInverseResponse->SetBinError  (fFlatInvBin[iBin],0.);
     }
   } 
-  delete priorTimesEff ;
 }
 
 //______________________________________________________________
@@ -423,22 +461,28 @@ void AliCFUnfolding::CreateUnfolded() {
   // otherwise the normal unfolded spectrum is created
 
   fUnfolded->Reset();
-  
-  for (Long_t iBin=0; iBin<fInverseResponse->GetNbins(); iBin++) {
-    Double_t invResponseValue = fInverseResponse->GetBinContent(iBin,fCoordinates2N);
-    GetCoordinates();
-    Double_t effValue      = fEfficiency->GetBinContent(fCoordinatesN_T);
-    Double_t measuredValue = fMeasured  ->GetBinContent(fCoordinatesN_M);
-    Double_t fill = (effValue>0. ? invResponseValue * measuredValue / effValue : 0.) ;
+
+  // measured and efficiency values in the cells of the response
+  for (Int_t iM=0; iM<fNFlatM; iM++) fFlatMeasured[iM] = fMeasured  ->GetBinContent(&fFlatCoordM[iM*fNVariables]);
+  for (Int_t iT=0; iT<fNFlatT; iT++) fFlatEff     [iT] = fEfficiency->GetBinContent(&fFlatCoordT[iT*fNVariables]);
+
+  fFlatValuesT.assign(fNFlatT,0.);
+  fFlatFilled.clear();
+  const Long_t nBins = fFlatInv.size();
+  for (Long_t iBin=0; iBin<nBins; iBin++) {
+    Int_t iT = fFlatT[iBin];
+    Double_t effValue      = fFlatEff[iT];
+    Double_t measuredValue = fFlatMeasured[fFlatM[iBin]];
+    Double_t fill = (effValue>0. ? fFlatInv[iBin] * measuredValue / effValue : 0.) ;
 
     if (fill>0.) {
-      // set errors to zero
-      // true errors will be filled afterwards
-      Double_t err = 0.;
-      fUnfolded->SetBinError  (fCoordinatesN_T,err);
-      fUnfolded->AddBinContent(fCoordinatesN_T,fill);
+      if (fFlatValuesT[iT]==0.) fFlatFilled.push_back(iT);
+      fFlatValuesT[iT] += fill;
     }
   }
+  // errors are set to zero
+  // true errors will be filled afterwards
+  FillFromFlat(fUnfolded,fFlatCoordT,fFlatValuesT);
 }
 
 //______________________________________________________________
@@ -620,6 +664,84 @@ void AliCFUnfolding::CreateConditional() {
 }
 //______________________________________________________________
 
+void AliCFUnfolding::CreateFlatResponse() {
+  //
+  // Converts once the conditional and inverse response matrices into flat arrays :
+  // for each bin of the response, the index of its measured and true cells,
+  // the conditional probability and the inverse response value.
+  // The bayes iterations then run on these arrays, in the bin order of the
+  // THnSparse, instead of looking up each bin of the response in the spectra.
+  //
+
+  const Long64_t nBins = fConditional->GetNbins();
+  fFlatM     .resize(nBins);
+  fFlatT     .resize(nBins);
+  fFlatCond  .resize(nBins);
+  fFlatInv   .resize(nBins);
+  fFlatInvBin.resize(nBins);
+  fFlatCoordM.clear();
+  fFlatCoordT.clear();
+
+  // linear cell index from the coordinates, to identify the distinct cells
+  std::vector<Long64_t> stride(2*fNVariables);
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    stride[iVar]             = (iVar==0 ? 1 : stride[iVar-1]             * (fConditional->GetAxis(iVar-1)           ->GetNbins()+2));
+    stride[iVar+fNVariables] = (iVar==0 ? 1 : stride[iVar+fNVariables-1] * (fConditional->GetAxis(iVar+fNVariables-1)->GetNbins()+2));
+  }
+  std::map<Long64_t,Int_t> cellsM, cellsT;
+
+  for (Long64_t iBin=0; iBin<nBins; iBin++) {
+    fFlatCond[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    fFlatInvBin[iBin] = fInverseResponse->GetBin(fCoordinates2N,kTRUE);
+    fFlatInv[iBin]    = fInverseResponse->GetBinContent(fFlatInvBin[iBin]);
+
+    Long64_t keyM = 0, keyT = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+      keyM += fCoordinatesN_M[iVar] * stride[iVar];
+      keyT += fCoordinatesN_T[iVar] * stride[iVar+fNVariables];
+    }
+    std::map<Long64_t,Int_t>::iterator itM = cellsM.find(keyM);
+    if (itM == cellsM.end()) {
+      itM = cellsM.insert(std::make_pair(keyM,(Int_t)cellsM.size())).first;
+      fFlatCoordM.insert(fFlatCoordM.end(),fCoordinatesN_M,fCoordinatesN_M+fNVariables);
+    }
+    std::map<Long64_t,Int_t>::iterator itT = cellsT.find(keyT);
+    if (itT == cellsT.end()) {
+      itT = cellsT.insert(std::make_pair(keyT,(Int_t)cellsT.size())).first;
+      fFlatCoordT.insert(fFlatCoordT.end(),fCoordinatesN_T,fCoordinatesN_T+fNVariables);
+    }
+    fFlatM[iBin] = itM->second;
+    fFlatT[iBin] = itT->second;
+  }
+
+  fNFlatM = cellsM.size();
+  fNFlatT = cellsT.size();
+  fFlatPriorEff.assign(fNFlatT,0.);
+  fFlatEff     .assign(fNFlatT,0.);
+  fFlatMeasured.assign(fNFlatM,0.);
+  fFlatValuesM .assign(fNFlatM,0.);
+  fFlatValuesT .assign(fNFlatT,0.);
+  AliInfo(Form("Flat response : %lld bins, %d measured cells, %d true cells",nBins,fNFlatM,fNFlatT));
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillFromFlat(THnSparse* hist, const std::vector<Int_t>& coord, const std::vector<Double_t>& values) {
+  //
+  // Adds the values of the cells listed in fFlatFilled to hist, in the order they were first filled,
+  // with errors set to zero
+  //
+  for (UInt_t i=0; i<fFlatFilled.size(); i++) {
+    Int_t iCell = fFlatFilled[i];
+    const Int_t* c = &coord[iCell*fNVariables];
+    hist->AddBinContent(c,values[iCell]);
+    hist->SetBinError  (c,0.);
+  }
+}
+
+//______________________________________________________________
+
 Int_t AliCFUnfolding::GetDOF() {
   //
   // number of dof = number of bins
@@ -10,6 +10,7 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -112,6 +113,23 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* flat representation of the response used in the iterations */
+  Int_t                  fNFlatM;        //! Number of distinct measured cells of the response matrix
+  Int_t                  fNFlatT;        //! Number of distinct true cells of the response matrix
+  std::vector<Int_t>     fFlatM;         //! Measured cell index of each response bin
+  std::vector<Int_t>     fFlatT;         //! True cell index of each response bin
+  std::vector<Double_t>  fFlatCond;      //! Conditional probability of each response bin
+  std::vector<Double_t>  fFlatInv;       //! Inverse response of each response bin (mirrors fInverseResponse)
+  std::vector<Long64_t>  fFlatInvBin;    //! Bin index in fInverseResponse of each response bin
+  std::vector<Int_t>     fFlatCoordM;    //! Coordinates of the measured cells [fNFlatM*fNVariables]
+  std::vector<Int_t>     fFlatCoordT;    //! Coordinates of the true cells [fNFlatT*fNVariables]
+  std::vector<Double_t>  fFlatPriorEff;  //! Prior times efficiency in the true cells
+  std::vector<Double_t>  fFlatEff;       //! Efficiency in the true cells
+  std::vector<Double_t>  fFlatMeasured;  //! Measured spectrum in the measured cells
+  std::vector<Double_t>  fFlatValuesM;   //! Measured estimate in the measured cells
+  std::vector<Double_t>  fFlatValuesT;   //! Unfolded spectrum in the true cells
+  std::vector<Int_t>     fFlatFilled;    //! Cells filled in the current kernel, in filling order
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -121,6 +139,8 @@ class AliCFUnfolding : public TNamed {
   void     CreateInvResponse();     // creates the inverse response function (Bayes Theorem) from the conditional matrix and the prior distribution
   void     CreateUnfolded();        // creates the unfolded spectrum from the inverse response matrix and the measured distribution
   void     CreateFlatPrior();       // creates a flat a priori distribution in case the one given in the constructor is null
+  void     CreateFlatResponse();    // creates the flat representation of the conditional and inverse response matrices
+  void     FillFromFlat(THnSparse* hist, const std::vector<Int_t>& coord, const std::vector<Double_t>& values); // fills the cells listed in fFlatFilled
   Double_t GetChi2();               // returns the chi2 between unfolded and prior spectra
   Short_t  Smooth();                // function calling smoothing methods
   Short_t  SmoothUsingFunction();   // smoothes the unfolded spectrum using a fit function
@@ -132,7 +152,7 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
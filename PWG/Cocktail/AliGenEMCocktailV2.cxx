@@ -71,7 +71,8 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fUseYWeighting(kFALSE),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
-  fSelectedParticles(kGenHadrons)
+  fSelectedParticles(kGenHadrons),
+  fPtTableNPoints(0)
 {
   // Constructor
 }
@@ -185,6 +186,7 @@ void AliGenEMCocktailV2::CreateCocktail()
   AliGenEMlibV2::SelectParams(fCollisionSystem, fCentrality,fV2Systematic);
   AliGenEMlibV2::SetMtScalingFactors(fParametrizationFile, fParametrizationDir);
   SetMtScalingFactors();
+  AliGenEMlibV2::SetPtParametrizationTable(fPtTableNPoints);
   AliGenEMlibV2::SetPtParametrizations(fParametrizationFile, fParametrizationDir);
   SetPtParametrizations();
 
@@ -66,6 +66,7 @@ public:
   void    SetCentrality(AliGenEMlibV2::Centrality_t cent)             { fCentrality = cent;               }
   void    SetV2Systematic(AliGenEMlibV2::v2Sys_t v2sys)               { fV2Systematic = v2sys;            }
   void    SetForceGammaConversion(Bool_t force=kTRUE)                 { fForceConv=force;                 }
+  void    SetPtParametrizationTable(Int_t nPoints)                    { fPtTableNPoints=nPoints;          }
   void    SetHeaviestHadron(ParticleGenerator_t part);
   static  Bool_t  SetPtParametrizations();
   static  void    SetMtScalingFactors();
@@ -135,8 +136,9 @@ private:
   Bool_t        fDynPtRange;                            // select if the pt range for the generation should be adapted to different mother particle weights dynamically
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
+  Int_t         fPtTableNPoints;                        // number of points of the tabulated pt parametrizations, 0: evaluate the TF1s
   
-  ClassDef(AliGenEMCocktailV2,8)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
 };
 
 #endif
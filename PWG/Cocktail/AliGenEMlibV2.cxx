@@ -47,6 +47,11 @@ TH2F* AliGenEMlibV2::fPtYDistribution[]         = {0x0};
 Int_t AliGenEMlibV2::fgSelectedCollisionsSystem = AliGenEMlibV2::kpp7TeV;
 Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
+Int_t AliGenEMlibV2::fgPtTableNPoints           = 0;
+Double_t AliGenEMlibV2::fgPtTableLogMin[]       = {0.};
+Double_t AliGenEMlibV2::fgPtTableLogStep[]      = {0.};
+std::vector<Double_t> AliGenEMlibV2::fgPtTable[26];
+std::vector<Double_t> AliGenEMlibV2::fgPtTableLog[26];
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -269,7 +274,7 @@ Int_t AliGenEMlibV2::IpPizero(TRandom *)
 Double_t AliGenEMlibV2::PtPizero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPizero]->Eval(pt);
+  return EvalPtParametrization(kPizero, pt);
 }
 
 Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
@@ -341,7 +346,7 @@ Int_t AliGenEMlibV2::IpEta(TRandom *)
 Double_t AliGenEMlibV2::PtEta( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEta]->Eval(pt);
+  return EvalPtParametrization(kEta, pt);
 }
 
 Double_t AliGenEMlibV2::YEta( const Double_t *py, const Double_t */*dummy*/ )
@@ -369,7 +374,7 @@ Int_t AliGenEMlibV2::IpRho0(TRandom *)
 Double_t AliGenEMlibV2::PtRho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRho0]->Eval(pt);
+  return EvalPtParametrization(kRho0, pt);
 }
 
 Double_t AliGenEMlibV2::YRho0( const Double_t *py, const Double_t */*dummy*/ )
@@ -397,7 +402,7 @@ Int_t AliGenEMlibV2::IpOmega(TRandom *)
 Double_t AliGenEMlibV2::PtOmega( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmega]->Eval(pt);
+  return EvalPtParametrization(kOmega, pt);
 }
 
 Double_t AliGenEMlibV2::YOmega( const Double_t *py, const Double_t */*dummy*/ )
@@ -426,7 +431,7 @@ Int_t AliGenEMlibV2::IpEtaprime(TRandom *)
 Double_t AliGenEMlibV2::PtEtaprime( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEtaprime]->Eval(pt);
+  return EvalPtParametrization(kEtaprime, pt);
 }
 
 Double_t AliGenEMlibV2::YEtaprime( const Double_t *py, const Double_t */*dummy*/ )
@@ -455,7 +460,7 @@ Int_t AliGenEMlibV2::IpPhi(TRandom *)
 Double_t AliGenEMlibV2::PtPhi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPhi]->Eval(pt);
+  return EvalPtParametrization(kPhi, pt);
 }
 
 Double_t AliGenEMlibV2::YPhi( const Double_t *py, const Double_t */*dummy*/ )
@@ -483,7 +488,7 @@ Int_t AliGenEMlibV2::IpJpsi(TRandom *)
 Double_t AliGenEMlibV2::PtJpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kJpsi]->Eval(pt);
+  return EvalPtParametrization(kJpsi, pt);
 }
 
 Double_t AliGenEMlibV2::YJpsi( const Double_t *py, const Double_t */*dummy*/ )
@@ -521,7 +526,7 @@ Int_t AliGenEMlibV2::IpSigma0(TRandom *)
 Double_t AliGenEMlibV2::PtSigma0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigma0]->Eval(pt);
+  return EvalPtParametrization(kSigma0, pt);
 }
 
 Double_t AliGenEMlibV2::YSigma0( const Double_t *py, const Double_t */*dummy*/ )
@@ -550,7 +555,7 @@ Int_t AliGenEMlibV2::IpK0short(TRandom *)
 Double_t AliGenEMlibV2::PtK0short( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0s]->Eval(pt);
+  return EvalPtParametrization(kK0s, pt);
 }
 
 Double_t AliGenEMlibV2::YK0short( const Double_t *py, const Double_t */*dummy*/ )
@@ -579,7 +584,7 @@ Int_t AliGenEMlibV2::IpK0long(TRandom *)
 Double_t AliGenEMlibV2::PtK0long( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0l]->Eval(pt);
+  return EvalPtParametrization(kK0l, pt);
 }
 
 Double_t AliGenEMlibV2::YK0long( const Double_t *py, const Double_t */*dummy*/ )
@@ -608,7 +613,7 @@ Int_t AliGenEMlibV2::IpLambda(TRandom *)
 Double_t AliGenEMlibV2::PtLambda( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kLambda]->Eval(pt);
+  return EvalPtParametrization(kLambda, pt);
 }
 
 Double_t AliGenEMlibV2::YLambda( const Double_t *py, const Double_t */*dummy*/ )
@@ -637,7 +642,7 @@ Int_t AliGenEMlibV2::IpDeltaPlPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPlPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPlPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPlPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPlPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -666,7 +671,7 @@ Int_t AliGenEMlibV2::IpDeltaPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -695,7 +700,7 @@ Int_t AliGenEMlibV2::IpDeltaMi(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaMi]->Eval(pt);
+  return EvalPtParametrization(kDeltaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -724,7 +729,7 @@ Int_t AliGenEMlibV2::IpDeltaZero(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaZero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaZero]->Eval(pt);
+  return EvalPtParametrization(kDeltaZero, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaZero( const Double_t *py, const Double_t */*dummy*/ )
@@ -753,7 +758,7 @@ Int_t AliGenEMlibV2::IpRhoPl(TRandom *)
 Double_t AliGenEMlibV2::PtRhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoPl]->Eval(pt);
+  return EvalPtParametrization(kRhoPl, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -782,7 +787,7 @@ Int_t AliGenEMlibV2::IpRhoMi(TRandom *)
 Double_t AliGenEMlibV2::PtRhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoMi]->Eval(pt);
+  return EvalPtParametrization(kRhoMi, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -811,7 +816,7 @@ Int_t AliGenEMlibV2::IpK0star(TRandom *)
 Double_t AliGenEMlibV2::PtK0star( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0star]->Eval(pt);
+  return EvalPtParametrization(kK0star, pt);
 }
 
 Double_t AliGenEMlibV2::YK0star( const Double_t *py, const Double_t */*dummy*/ )
@@ -840,7 +845,7 @@ Int_t AliGenEMlibV2::IpKPl(TRandom *)
 Double_t AliGenEMlibV2::PtKPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKPl]->Eval(pt);
+  return EvalPtParametrization(kKPl, pt);
 }
 
 Double_t AliGenEMlibV2::YKPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -868,7 +873,7 @@ Int_t AliGenEMlibV2::IpKMi(TRandom *)
 Double_t AliGenEMlibV2::PtKMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKMi]->Eval(pt);
+  return EvalPtParametrization(kKMi, pt);
 }
 
 Double_t AliGenEMlibV2::YKMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -896,7 +901,7 @@ Int_t AliGenEMlibV2::IpOmegaPl(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaPl]->Eval(pt);
+  return EvalPtParametrization(kOmegaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -924,7 +929,7 @@ Int_t AliGenEMlibV2::IpOmegaMi(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaMi]->Eval(pt);
+  return EvalPtParametrization(kOmegaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -952,7 +957,7 @@ Int_t AliGenEMlibV2::IpXiPl(TRandom *)
 Double_t AliGenEMlibV2::PtXiPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiPl]->Eval(pt);
+  return EvalPtParametrization(kXiPl, pt);
 }
 
 Double_t AliGenEMlibV2::YXiPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -980,7 +985,7 @@ Int_t AliGenEMlibV2::IpXiMi(TRandom *)
 Double_t AliGenEMlibV2::PtXiMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiMi]->Eval(pt);
+  return EvalPtParametrization(kXiMi, pt);
 }
 
 Double_t AliGenEMlibV2::YXiMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1008,7 +1013,7 @@ Int_t AliGenEMlibV2::IpSigmaPl(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaPl]->Eval(pt);
+  return EvalPtParametrization(kSigmaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1036,7 +1041,7 @@ Int_t AliGenEMlibV2::IpSigmaMi(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaMi]->Eval(pt);
+  return EvalPtParametrization(kSigmaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1255,6 +1260,8 @@ Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
   fParametrizationFile->Close();
   delete fParametrizationFile;
   
+  BuildPtParametrizationTables();
+  
   return kTRUE;
 }
 
@@ -1273,6 +1280,55 @@ TF1* AliGenEMlibV2::GetPtParametrization(Int_t np) {
     return NULL;
 }
 
+//_________________________________________________________________________
+void AliGenEMlibV2::BuildPtParametrizationTables() {
+  
+  // tabulate the pt parametrizations once per configuration, on points equidistant
+  // in log(pt), such that the pt functions given to AliGenParam (used for the yield
+  // integrals and the sampling tables) do not evaluate the TF1s every time
+  Double_t xmin, xmax;
+  for (Int_t np=0; np<26; np++) {
+    fgPtTable[np].clear();
+    fgPtTableLog[np].clear();
+    if (fgPtTableNPoints < 2 || !fPtParametrization[np]) continue;
+    
+    fPtParametrization[np]->GetRange(xmin, xmax);
+    if (xmin < 1.e-3) xmin = 1.e-3;
+    if (xmax <= xmin) continue;
+    fgPtTableLogMin[np]  = TMath::Log(xmin);
+    fgPtTableLogStep[np] = (TMath::Log(xmax)-fgPtTableLogMin[np])/(fgPtTableNPoints-1);
+    fgPtTable[np].resize(fgPtTableNPoints);
+    fgPtTableLog[np].resize(fgPtTableNPoints);
+    for (Int_t i=0; i<fgPtTableNPoints; i++) {
+      Double_t value = fPtParametrization[np]->Eval(TMath::Exp(fgPtTableLogMin[np]+i*fgPtTableLogStep[np]));
+      fgPtTable[np][i] = value;
+      fgPtTableLog[np][i] = (value > 0. ? TMath::Log(value) : 0.);
+    }
+  }
+}
+
+//_________________________________________________________________________
+Double_t AliGenEMlibV2::EvalPtParametrization(Int_t np, Double_t pt) {
+  
+  // value of the pt parametrization np at pt, interpolated in log-log from the
+  // table if it was built, evaluated from the TF1 otherwise or outside of the table
+  const std::vector<Double_t>& table = fgPtTable[np];
+  if (table.empty() || pt <= 0.)
+    return fPtParametrization[np]->Eval(pt);
+  
+  Double_t u = (TMath::Log(pt)-fgPtTableLogMin[np])/fgPtTableLogStep[np];
+  Int_t i = (Int_t)u;
+  if (u < 0. || i >= (Int_t)table.size()-1) {
+    if (u >= 0. && i == (Int_t)table.size()-1 && u-i < 1.e-9) return table[i];
+    return fPtParametrization[np]->Eval(pt);
+  }
+  
+  Double_t frac = u-i;
+  if (table[i] > 0. && table[i+1] > 0.)
+    return TMath::Exp(fgPtTableLog[np][i] + frac*(fgPtTableLog[np][i+1]-fgPtTableLog[np][i]));
+  return table[i] + frac*(table[i+1]-table[i]);
+}
+
 
 //--------------------------------------------------------------------------
 //
@@ -14,6 +14,8 @@
 //                                                                         //
 /////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include "AliGenLib.h"
 #include "TRandom.h"
 #include "TObject.h"
@@ -65,6 +67,9 @@ public:
   static void   SetMtScalingFactors(TString fileName, TString dirName);
   static Bool_t SetPtYDistributions(TString fileName, TString dirName);
   static TF1*   GetPtParametrization(Int_t np);
+  // tabulate the pt parametrizations on nPoints logarithmic pt points (0: evaluate the TF1s)
+  static void   SetPtParametrizationTable(Int_t nPoints) { fgPtTableNPoints = nPoints; }
+  static Double_t EvalPtParametrization(Int_t np, Double_t pt);
   static TH1D*  GetMtScalingFactors();
   static TH2F*  GetPtYDistribution(Int_t np);
 
@@ -270,6 +275,13 @@ private:
   static TH1D*    fMtFactorHisto;             // mt scaling factors
   static TH2F*    fPtYDistribution[26];       // pt-y distributions
 
+  static void     BuildPtParametrizationTables();
+  static Int_t    fgPtTableNPoints;           // number of points of the pt parametrization tables, 0 if not used
+  static Double_t fgPtTableLogMin[26];        // log(pt) of the first point of the tables
+  static Double_t fgPtTableLogStep[26];       // log(pt) step of the tables
+  static std::vector<Double_t> fgPtTable[26]; // pt parametrizations at the table points
+  static std::vector<Double_t> fgPtTableLog[26]; // log of the pt parametrizations at the table points, 0 if not positive
+
   ClassDef(AliGenEMlibV2,7);
 };
 
@@ -72,7 +72,12 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
-  fADCtoGeV(1.)
+  fADCtoGeV(1.),
+  fBadFastORMask(),
+  fOfflineBadCellMask(),
+  fBadChannelMasksValid(kFALSE),
+  fTRUIndexMap(),
+  fSmearedEnergyIntegral()
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
@@ -119,6 +124,17 @@ void AliEmcalTriggerMakerKernel::Init(){
     fPatchEnergySimpleSmeared = new AliEMCALTriggerDataGrid<double>;
     fPatchEnergySimpleSmeared->Allocate(48, nrows);
   }
+
+  // Lookup table of the TRU index for each FastOR position, used in the level0 check
+  fTRUIndexMap.assign(kColsEta * nrows, -1);
+  for(int irow = 0; irow < nrows; irow++){
+    for(int icol = 0; icol < kColsEta; icol++){
+      Int_t absFastor(-1), truindex(-1), adc(-1);
+      fGeometry->GetAbsFastORIndexFromPositionInEMCAL(icol, irow, absFastor);
+      fGeometry->GetTRUFromAbsFastORIndex(absFastor, truindex, adc);
+      fTRUIndexMap[icol + irow * kColsEta] = truindex;
+    }
+  }
 }
 
 void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -299,6 +315,7 @@ void AliEmcalTriggerMakerKernel::Reset(){
 }
 
 void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
+  if(!fBadChannelMasksValid) BuildBadChannelMasks();
   trigger->Reset();
   Int_t globCol=-1, globRow=-1;
   Int_t adcAmp=-1, bitmap = 0;
@@ -341,7 +358,7 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
     }
 
     // exclude channel completely if it is masked as hot channel
-    if (fBadChannels.find(absId) != fBadChannels.end()){
+    if (IsBadFastOR(absId)){
       AliDebugStream(1) << "Found ADC for masked fastor " << absId << ", rejecting" << std::endl;
       continue;
     }
@@ -385,13 +402,14 @@ void AliEmcalTriggerMakerKernel::ReadTriggerData(AliVCaloTrigger *trigger){
 
 void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
   // fill the patch ADCs from cells
+  if(!fBadChannelMasksValid) BuildBadChannelMasks();
   Int_t nCell = cells->GetNumberOfCells();
   for(Int_t iCell = 0; iCell < nCell; ++iCell) {
     // get the cell info, based in index in array
     Short_t cellId = cells->GetCellNumber(iCell);
 
     // Check bad channel map
-    if (fOfflineBadChannels.find(cellId) != fOfflineBadChannels.end()) {
+    if (IsOfflineBadCell(cellId)) {
       AliDebugStream(1) << "Cell " << cellId << " masked as bad channel, rejecting." << std::endl;
       continue;
     }
@@ -407,7 +425,7 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
       // Exclude FEE amplitudes from cells which are within a TRU which is masked at
       // online level. Using this the online acceptance can be applied to offline
       // patches as well.
-      if(fBadChannels.find(absId) != fBadChannels.end()){
+      if(IsBadFastOR(absId)){
         AliDebugStream(1) << "Cell " << cellId << " corresponding to masked fastor " << absId << ", rejecting." << std::endl;
         continue;
       }
@@ -424,10 +442,14 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
   }
 
   // Apply energy smearing (if enabled)
+  // The integral image of the smeared energies is built in the same loop:
+  // entry (icol+1, irow+1) is the sum over the columns <= icol and rows <= irow
   if(fPatchEnergySimpleSmeared){
     AliDebugStream(1) << "Trigger Maker: Apply energy smearing" << std::endl;
+    const int nrows = fPatchADCSimple->GetNumberOfRows(), stride = nrows + 1;
+    fSmearedEnergyIntegral.assign((fPatchADCSimple->GetNumberOfCols() + 1) * stride, 0.);
     for(int icol = 0; icol < fPatchADCSimple->GetNumberOfCols(); icol++){
-      for(int irow = 0; irow < fPatchADCSimple->GetNumberOfRows(); irow++){
+      for(int irow = 0; irow < nrows; irow++){
         double energyorig = (*fPatchADCSimple)(icol, irow) * fADCtoGeV;          // Apply smearing in GeV
         double energysmear = energyorig;
         if(energyorig > fSmearThreshold){
@@ -437,6 +459,10 @@ void AliEmcalTriggerMakerKernel::ReadCellData(AliVCaloCells *cells){
           AliDebugStream(1) << "Original energy " << energyorig << ", mean " << mean << ", sigma " << sigma << ", smeared " << energysmear << std::endl;
         }
         (*fPatchEnergySimpleSmeared)(icol, irow) = energysmear;
+        fSmearedEnergyIntegral[(icol + 1) * stride + irow + 1] = energysmear
+            + fSmearedEnergyIntegral[icol * stride + irow + 1]
+            + fSmearedEnergyIntegral[(icol + 1) * stride + irow]
+            - fSmearedEnergyIntegral[icol * stride + irow];
       }
     }
     AliDebugStream(1) << "Smearing done" << std::endl;
@@ -530,12 +556,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -561,12 +582,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       fullpatch.SetSmearedEnergy(energysmear);
     }
     outputcont.push_back(fullpatch);
@@ -638,19 +654,19 @@ AliEmcalTriggerMakerKernel::ELevel0TriggerStatus_t AliEmcalTriggerMakerKernel::C
     AliError(Form("Patch outside range [col %d, row %d]", col, row));
     return kNotLevel0;
   }
-  Int_t truref(-1), trumod(-1), absFastor(-1), adc(-1);
-  fGeometry->GetAbsFastORIndexFromPositionInEMCAL(col, row, absFastor);
-  fGeometry->GetTRUFromAbsFastORIndex(absFastor, truref, adc);
-  int nvalid(0);
   const int kNRowsPhi = fGeometry->GetNTotalTRU() * 2;
+  if(col >= kColsEta || row >= kNRowsPhi){
+    AliError(Form("Patch outside range [col %d, row %d]", col, row));
+    return kNotLevel0;
+  }
+  Int_t truref = fTRUIndexMap[col + row * kColsEta], trumod(-1);
+  int nvalid(0);
   for(int ipos = 0; ipos < 2; ipos++){
     if(row + ipos >= kNRowsPhi) continue;    // boundary check
     for(int jpos = 0; jpos < 2; jpos++){
       if(col + jpos >= kColsEta) continue;  // boundary check
       // Check whether we are in the same TRU
-      trumod = -1;
-      fGeometry->GetAbsFastORIndexFromPositionInEMCAL(col+jpos, row+ipos, absFastor);
-      fGeometry->GetTRUFromAbsFastORIndex(absFastor, trumod, adc);
+      trumod = fTRUIndexMap[(col + jpos) + (row + ipos) * kColsEta];
       if(trumod != truref) {
         result = kNotLevel0;
         return result;
@@ -667,10 +683,34 @@ AliEmcalTriggerMakerKernel::ELevel0TriggerStatus_t AliEmcalTriggerMakerKernel::C
 
 void AliEmcalTriggerMakerKernel::ClearFastORBadChannels(){
   fBadChannels.clear();
+  fBadChannelMasksValid = kFALSE;
 }
 
 void AliEmcalTriggerMakerKernel::ClearOfflineBadChannels() {
   fOfflineBadChannels.clear();
+  fBadChannelMasksValid = kFALSE;
+}
+
+void AliEmcalTriggerMakerKernel::BuildBadChannelMasks() {
+  fBadFastORMask.assign(fBadChannels.size() && *fBadChannels.rbegin() >= 0 ? *fBadChannels.rbegin() + 1 : 0, false);
+  for(std::set<Short_t>::const_iterator it = fBadChannels.begin(); it != fBadChannels.end(); ++it){
+    if(*it >= 0) fBadFastORMask[*it] = true;
+  }
+  fOfflineBadCellMask.assign(fOfflineBadChannels.size() && *fOfflineBadChannels.rbegin() >= 0 ? *fOfflineBadChannels.rbegin() + 1 : 0, false);
+  for(std::set<Short_t>::const_iterator it = fOfflineBadChannels.begin(); it != fOfflineBadChannels.end(); ++it){
+    if(*it >= 0) fOfflineBadCellMask[*it] = true;
+  }
+  fBadChannelMasksValid = kTRUE;
+}
+
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const {
+  const int ncols = fPatchEnergySimpleSmeared->GetNumberOfCols(), nrows = fPatchEnergySimpleSmeared->GetNumberOfRows(), stride = nrows + 1;
+  int colmax = col + size, rowmax = row + size;
+  if(colmax > ncols) colmax = ncols;
+  if(rowmax > nrows) rowmax = nrows;
+  if(col < 0 || row < 0 || col >= colmax || row >= rowmax) return 0.;
+  return fSmearedEnergyIntegral[colmax * stride + rowmax] - fSmearedEnergyIntegral[col * stride + rowmax]
+       - fSmearedEnergyIntegral[colmax * stride + row] + fSmearedEnergyIntegral[col * stride + row];
 }
 
 Bool_t AliEmcalTriggerMakerKernel::IsGammaPatch(const AliEMCALTriggerRawPatch &patch) const {
@@ -203,7 +203,7 @@ public:
    * @brief Add a FastOR bad channel to the list
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); }
+  void AddFastORBadChannel(Short_t absId) { fBadChannels.insert(absId); fBadChannelMasksValid = kFALSE; }
 
   /**
    * @brief Read the FastOR bad channel map from a standard stream
@@ -226,7 +226,7 @@ public:
    * @brief Add an offline bad channel to the set
    * @param[in] absId Absolute ID of the bad channel
    */
-  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); }
+  void AddOfflineBadChannel(Short_t absId) { fOfflineBadChannels.insert(absId); fBadChannelMasksValid = kFALSE; }
 
   /**
    * @brief Read the offline bad channel map from a standard stream
@@ -459,6 +459,36 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * Convert the bad FastOR and bad cell sets into flat masks indexed
+   * by absolute ID. Called when the sets changed, i.e. at run change.
+   */
+  void BuildBadChannelMasks();
+
+  /**
+   * Check in the flat mask whether a FastOR is masked as bad
+   * @param[in] absId Absolute ID of the FastOR
+   * @return True if the FastOR is in the list of bad FastORs
+   */
+  Bool_t IsBadFastOR(Int_t absId) const { return absId >= 0 && absId < static_cast<Int_t>(fBadFastORMask.size()) && fBadFastORMask[absId]; }
+
+  /**
+   * Check in the flat mask whether a cell is masked as bad
+   * @param[in] absId Absolute ID of the cell
+   * @return True if the cell is in the list of offline bad channels
+   */
+  Bool_t IsOfflineBadCell(Int_t absId) const { return absId >= 0 && absId < static_cast<Int_t>(fOfflineBadCellMask.size()) && fOfflineBadCellMask[absId]; }
+
+  /**
+   * Get the sum of the smeared energies in a patch from the
+   * integral image built in ReadCellData
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Patch size in FastORs
+   * @return Smeared patch energy
+   */
+  double GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -495,8 +525,14 @@ protected:
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
+  std::vector<bool>                         fBadFastORMask;               //!<! Bad FastOR flags indexed by abs. ID, built from fBadChannels
+  std::vector<bool>                         fOfflineBadCellMask;          //!<! Bad cell flags indexed by abs. ID, built from fOfflineBadChannels
+  Bool_t                                    fBadChannelMasksValid;        //!<! False if the bad channel sets changed since the masks were built
+  std::vector<int>                          fTRUIndexMap;                 //!<! TRU index of each FastOR position in the data grid (col + row * kColsEta)
+  std::vector<double>                       fSmearedEnergyIntegral;       //!<! Integral image of the smeared energy grid, (cols+1) x (rows+1)
+
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
@@ -26,6 +26,7 @@
 #include "TH1D.h"
 #include "TFile.h"
 #include "AliPIDResponse.h"
+#include "AliInputEventHandler.h"
 
 
 ClassImp(AliFlowBayesianPID)
@@ -36,7 +37,7 @@ TH1D* AliFlowBayesianPID::fgHtofChannelDist=NULL;
 
 //________________________________________________________________________
 AliFlowBayesianPID::AliFlowBayesianPID(AliESDpid *esdpid) 
-  :      AliPIDResponse(), fPIDesd(NULL), fDB(TDatabasePDG::Instance()), fNewTrackParam(0), fTOFresolution(84.0), fTOFResponseF(NULL), fTPCResponseF(NULL),fWTofMism(0.0), fProbTofMism(0.0), fZ(0) ,fMassTOF(0), fBBdata(NULL),fCurrCentrality(100),fPsi(999),fPsiRes(999),fIsMC(kFALSE),fForceOldDedx(kFALSE),fDedx(0.0),fIsTOFheaderAOD(0)
+  :      AliPIDResponse(), fPIDesd(NULL), fDB(TDatabasePDG::Instance()), fNewTrackParam(0), fTOFresolution(84.0), fTOFResponseF(NULL), fTPCResponseF(NULL),fWTofMism(0.0), fProbTofMism(0.0), fZ(0) ,fMassTOF(0), fBBdata(NULL),fCurrCentrality(100),fPsi(999),fPsiRes(999),fIsMC(kFALSE),fForceOldDedx(kFALSE),fDedx(0.0),fIsTOFheaderAOD(0),fTableCentrality(-9999),fTPCResScale(1),fTOFMismFrac(0),fEventProb(),fEventProbTofMism(),fEventMask()
 {
   // Constructor
   Bool_t redopriors = kFALSE;
@@ -410,11 +411,15 @@ void AliFlowBayesianPID::SetDetResponse(AliAODEvent *aod,Float_t centrality,ESta
 //________________________________________________________________________
 Float_t AliFlowBayesianPID::GetExpDeDx(const AliVTrack *t,Int_t iS) const{
   // tuned dE/dx (vs. eta and centrality)
-  Float_t momtpc=t->GetTPCmomentum();
-
   AliAnalysisManager *man=AliAnalysisManager::GetAnalysisManager();
   AliInputEventHandler* inputHandler = (AliInputEventHandler*) (man->GetInputEventHandler());
-  AliPIDResponse *PIDResponse=inputHandler->GetPIDResponse();
+
+  return GetExpDeDx(t,iS,inputHandler->GetPIDResponse());
+}
+//________________________________________________________________________
+Float_t AliFlowBayesianPID::GetExpDeDx(const AliVTrack *t,Int_t iS,AliPIDResponse *PIDResponse) const{
+  // tuned dE/dx (vs. eta and centrality), PID response of the input handler given by the caller
+  Float_t momtpc=t->GetTPCmomentum();
 
   Float_t dedxExp=0;
 
@@ -540,7 +545,11 @@ Float_t AliFlowBayesianPID::GetExpDeDx(const AliVTrack *t,Float_t mass) const{
 //________________________________________________________________________
 void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
   // compute Detector weights for Bayesian probablities
-  Float_t centr = fCurrCentrality;
+  if(fTableCentrality != fCurrCentrality) FillCentralityTables();
+
+  AliPIDResponse *pidResponse = NULL;
+  AliAnalysisManager *man=AliAnalysisManager::GetAnalysisManager();
+  if(man && man->GetInputEventHandler()) pidResponse = ((AliInputEventHandler*) (man->GetInputEventHandler()))->GetPIDResponse();
 
   Float_t pt = t->Pt();
   Float_t p = t->P();
@@ -610,7 +619,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
 
   if(t->GetStatus() & AliESDtrack::kTPCout && dedx > 40 && fMaskOR[0]){ // if TPC PID available    
     for(Int_t iS=0;iS<fgkNspecies;iS++){
-      Float_t dedxExp=GetExpDeDx(t,iS);
+      Float_t dedxExp=GetExpDeDx(t,iS,pidResponse);
       
       Float_t resolutionTPC = 1;
       if(iS==0) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kElectron); 
@@ -623,17 +632,9 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
       else if(iS==7) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[7])*5*0.07;
       else if(iS==8) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[8])*5*0.07;
       
-      if(centr < 0) resolutionTPC *= 0.78;
-      if(centr < 10) resolutionTPC *= 1.0;
-      else if(centr < 20) resolutionTPC *= 1.0;
-      else if(centr < 30) resolutionTPC *= 1.0;
-      else if(centr < 40) resolutionTPC *= 0.95;
-      else if(centr < 50) resolutionTPC *= 0.93;
-      else if(centr < 60) resolutionTPC *= 0.91;
-      else if(centr < 70) resolutionTPC *= 0.88;
-      else resolutionTPC *= 0.83;
+      resolutionTPC *= fTPCResScale;
       
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
+      fWeights[0][iS] = EvalResponse(fTPCResponsePar,(dedx - dedxExp)/resolutionTPC)/resolutionTPC;
     }
     fMaskCurrent[0] = kTRUE;
   }
@@ -645,9 +646,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
   // TOF
   fWTofMism = 0;
   if((t->GetStatus() & AliESDtrack::kTOFout) &&  (t->GetStatus() & AliESDtrack::kTIME) && t->GetIntegratedLength() > 365. && fMaskOR[1]){ // if TOF PID available
-    Float_t invCentr = 0;
-    if(centr >= 0) invCentr = 1 - centr/100;
-    Float_t mismfrac = 0.005 + 0.05*invCentr*invCentr*invCentr;
+    Float_t mismfrac = fTOFMismFrac;
 
     Float_t timeTOF = t->GetTOFsignal() - fPIDesd->GetTOFResponse().GetStartTime(p);
 
@@ -674,7 +673,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
       if (TMath::Abs(delta) > 5*expsigma) {
 	fWeights[1][iS] = mismfrac*mismweight;
       } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
+	fWeights[1][iS] = EvalResponse(fTOFResponsePar,delta/expsigma)/expsigma + mismfrac*mismweight;
     }
     fMaskCurrent[1] = kTRUE;
   }
@@ -695,7 +694,11 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
 //________________________________________________________________________
 void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *aod){
   // compute Detector weights for Bayesian probablities
-  Float_t centr = fCurrCentrality;
+  if(fTableCentrality != fCurrCentrality) FillCentralityTables();
+
+  AliPIDResponse *pidResponse = NULL;
+  AliAnalysisManager *man=AliAnalysisManager::GetAnalysisManager();
+  if(man && man->GetInputEventHandler()) pidResponse = ((AliInputEventHandler*) (man->GetInputEventHandler()))->GetPIDResponse();
 
   Float_t pt = t->Pt();
   Float_t p = t->P();
@@ -759,7 +762,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
   if(t->GetStatus() & AliESDtrack::kTPCout && dedx > 40 && fMaskOR[0]){ // if TPC PID available    
     for(Int_t iS=0;iS<fgkNspecies;iS++){
 
-      Float_t dedxExp=GetExpDeDx(t,iS);
+      Float_t dedxExp=GetExpDeDx(t,iS,pidResponse);
 
       Float_t resolutionTPC = 1;
       if(iS==0) resolutionTPC =  fPIDesd->GetTPCResponse().GetExpectedSigma(momtpc,t->GetTPCsignalN(),AliPID::kElectron); 
@@ -772,17 +775,9 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
       else if(iS==7) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[7])*5*0.07;
       else if(iS==8) resolutionTPC =  fPIDesd->GetTPCResponse().Bethe(momtpc/fMass[8])*5*0.07;
 
-      if(centr < 0) resolutionTPC *= 0.78;
-      if(centr < 10) resolutionTPC *= 1.0;
-      else if(centr < 20) resolutionTPC *= 1.0;
-      else if(centr < 30) resolutionTPC *= 1.0;
-      else if(centr < 40) resolutionTPC *= 0.95;
-      else if(centr < 50) resolutionTPC *= 0.93;
-      else if(centr < 60) resolutionTPC *= 0.91;
-      else if(centr < 70) resolutionTPC *= 0.88;
-      else resolutionTPC *= 0.83;
+      resolutionTPC *= fTPCResScale;
       
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
+      fWeights[0][iS] = EvalResponse(fTPCResponsePar,(dedx - dedxExp)/resolutionTPC)/resolutionTPC;
     }
     fMaskCurrent[0] = kTRUE;
   }
@@ -794,9 +789,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
   // TOF
   fWTofMism = 0;
   if((t->GetStatus() & AliESDtrack::kTOFout) &&  (t->GetStatus() & AliESDtrack::kTIME) && fMaskOR[1]){ // if TOF PID available
-    Float_t invCentr = 0;
-    if(centr >= 0) invCentr = 1 - centr/100;
-    Float_t mismfrac = 0.005 + 0.05*invCentr*invCentr*invCentr;
+    Float_t mismfrac = fTOFMismFrac;
 
     Float_t timeTOF = t->GetTOFsignal() - fPIDesd->GetTOFResponse().GetStartTime(p);
 
@@ -850,7 +843,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
       if (TMath::Abs(delta) > 5*expsigma) {
 	fWeights[1][iS] = mismfrac*mismweight;
       } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
+	fWeights[1][iS] = EvalResponse(fTOFResponsePar,delta/expsigma)/expsigma + mismfrac*mismweight;
     }
     fMaskCurrent[1] = kTRUE;
   }
@@ -875,9 +868,9 @@ void AliFlowBayesianPID::ComputeProb(const AliESDtrack *t,Float_t /*centrObsolet
   Float_t priors[fgkNspecies];
   fProbTofMism = 0;
 
-  Float_t centr = fCurrCentrality;
-
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  // priors at the current centrality, tabulated in FillCentralityTables (called by ComputeWeights)
+  Int_t ptbin = fghPriors[0]->GetYaxis()->FindBin(t->Pt());
+  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fPriorTable[ptbin][iS];
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -938,9 +931,9 @@ void AliFlowBayesianPID::ComputeProb(const AliAODTrack *t, const AliAODEvent *ao
   Float_t priors[fgkNspecies];
   fProbTofMism = 0;
 
-  Float_t centr = fCurrCentrality;
-
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  // priors at the current centrality, tabulated in FillCentralityTables (called by ComputeWeights)
+  Int_t ptbin = fghPriors[0]->GetYaxis()->FindBin(t->Pt());
+  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fPriorTable[ptbin][iS];
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -999,6 +992,85 @@ void AliFlowBayesianPID::SetPsiCorrectionDeDx(Float_t psi,Float_t res){
   fPsiRes=res;
 }
 //________________________________________________________________________
+void AliFlowBayesianPID::FillCentralityTables(){
+  // tabulate the quantities depending only on the centrality (priors vs pT, TPC resolution
+  // correction, TOF mismatch fraction) and the response function parameters,
+  // called when the centrality changes instead of being evaluated per track
+  fTableCentrality = fCurrCentrality;
+  Float_t centr = fCurrCentrality;
+
+  Int_t centrbin = fghPriors[0]->GetXaxis()->FindBin(centr);
+  for(Int_t ipt=0;ipt < fgkNpriorPtBins+2;ipt++){
+    for(Int_t iS=0;iS<fgkNspecies;iS++) fPriorTable[ipt][iS] = fghPriors[iS]->GetBinContent(centrbin,ipt);
+  }
+
+  fTPCResScale = 1;
+  if(centr < 0) fTPCResScale *= 0.78;
+  if(centr < 10) fTPCResScale *= 1.0;
+  else if(centr < 20) fTPCResScale *= 1.0;
+  else if(centr < 30) fTPCResScale *= 1.0;
+  else if(centr < 40) fTPCResScale *= 0.95;
+  else if(centr < 50) fTPCResScale *= 0.93;
+  else if(centr < 60) fTPCResScale *= 0.91;
+  else if(centr < 70) fTPCResScale *= 0.88;
+  else fTPCResScale *= 0.83;
+
+  Float_t invCentr = 0;
+  if(centr >= 0) invCentr = 1 - centr/100;
+  fTOFMismFrac = 0.005 + 0.05*invCentr*invCentr*invCentr;
+
+  for(Int_t i=0;i < 4;i++){
+    fTPCResponsePar[i] = fTPCResponseF->GetParameter(i);
+    fTOFResponsePar[i] = fTOFResponseF->GetParameter(i);
+  }
+}
+//________________________________________________________________________
+Float_t AliFlowBayesianPID::EvalResponse(const Double_t *par,Double_t x){
+  // compiled version of the fTPCResponseF/fTOFResponseF formula (Gaussian + exponential tail)
+  Double_t tail = par[1]+par[3]*par[2];
+  if(x < tail) return par[0]*TMath::Exp(-(x-par[1])*(x-par[1])/2/par[2]/par[2]);
+  if(x > tail) return par[0]*TMath::Exp(-(x-par[1]-par[3]*par[2]*0.5)*par[3]/par[2]);
+  return 0;
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::FillEventProb(Int_t itrack){
+  // store the probabilities of the last computed track at position itrack
+  for(Int_t iS=0;iS<fgkNspecies;iS++) fEventProb[itrack*fgkNspecies+iS] = fProb[iS];
+  fEventProbTofMism[itrack] = fProbTofMism;
+  fEventMask[itrack] = 0;
+  for(Int_t idet=0;idet < fgkNdetectors;idet++) if(fMaskCurrent[idet]) fEventMask[itrack] |= (1 << idet);
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ComputeProbEvent(const AliESDEvent *esd){
+  // compute Bayesian probablities for all the tracks of the event, to be called after SetDetResponse
+  Int_t ntracks = esd ? esd->GetNumberOfTracks() : 0;
+  fEventProb.assign(ntracks*fgkNspecies,0);
+  fEventProbTofMism.assign(ntracks,0);
+  fEventMask.assign(ntracks,0);
+
+  for(Int_t i=0;i < ntracks;i++){
+    const AliESDtrack *t = esd->GetTrack(i);
+    if(!t) continue;
+    ComputeProb(t);
+    FillEventProb(i);
+  }
+}
+//________________________________________________________________________
+void AliFlowBayesianPID::ComputeProbEvent(const AliAODEvent *aod){
+  // compute Bayesian probablities for all the tracks of the event, to be called after SetDetResponse
+  Int_t ntracks = aod ? aod->GetNumberOfTracks() : 0;
+  fEventProb.assign(ntracks*fgkNspecies,0);
+  fEventProbTofMism.assign(ntracks,0);
+  fEventMask.assign(ntracks,0);
+
+  for(Int_t i=0;i < ntracks;i++){
+    const AliAODTrack *t = dynamic_cast<const AliAODTrack*>(aod->GetTrack(i));
+    if(!t) continue;
+    ComputeProb(t,aod);
+    FillEventProb(i);
+  }
+}
+//________________________________________________________________________
 void AliFlowBayesianPID::SetPriors(){
   // set default TOF priors
   Float_t fBinLimitPID[18];
@@ -7,6 +7,7 @@
 #ifndef ALIFLOWBAYESIANPID_H
 #define ALIFLOWBAYESIANPID_H
 
+#include <vector>
 #include "AliESDpid.h"
 #include "AliPIDResponse.h"
 
@@ -68,6 +69,13 @@ More details:
      TH2D *hPr = mypid->GetHistoPriors(isp); // 2D (centrality - pT) histo for the priors of specie-isp (centrality < 0 means pp collisions)
                                              // all the priors are normalized to the pion ones
 
+Batched interface (after SetDetResponse), probabilities for all the tracks of the event in one pass:
+
+     mypid->ComputeProbEvent(aodEvent); // or esdEvent
+     for(Int_t i=0;i < mypid->GetNEventTracks();i++){ // same index as event->GetTrack(i)
+       const Float_t *prob = mypid->GetEventProb(i);
+     }
+
 */
 
 class AliFlowBayesianPID : public AliPIDResponse{
@@ -115,6 +123,14 @@ class AliFlowBayesianPID : public AliPIDResponse{
   void ComputeWeights(const AliAODTrack *t,const AliAODEvent *aod=NULL);
   void ComputeProb(const AliAODTrack *t,const AliAODEvent *aod=NULL); // obsolete method
 
+  // batched Bayesian Combined PID for all the tracks of the event
+  void ComputeProbEvent(const AliESDEvent *esd);
+  void ComputeProbEvent(const AliAODEvent *aod);
+  Int_t GetNEventTracks() const {return (Int_t) fEventProbTofMism.size();};
+  const Float_t *GetEventProb(Int_t itrack) const {return &fEventProb[itrack*fgkNspecies];};
+  Float_t GetEventTOFMismProb(Int_t itrack) const {return fEventProbTofMism[itrack];};
+  Bool_t GetEventMask(Int_t itrack,Int_t idet) const {return (fEventMask[itrack] >> idet) & 1;};
+
   void SetTOFres(Float_t res){fTOFresolution=res;};
 
   Float_t GetDeDx() const {return fDedx;};
@@ -123,6 +139,10 @@ class AliFlowBayesianPID : public AliPIDResponse{
 
  private: 
   void SetPriors();
+  void FillCentralityTables();
+  void FillEventProb(Int_t itrack);
+  Float_t GetExpDeDx(const AliVTrack *t,Int_t iS,AliPIDResponse *pidResponse) const;
+  static Float_t EvalResponse(const Double_t *par,Double_t x);
 
   static const Int_t fgkNdetectors = 2; // Number of detector used for PID
   static const Int_t fgkNspecies = 9;// 0=el, 1=mu, 2=pi, 3=ka, 4=pr, 5=deuteron, 6=triton, 7=He3 
@@ -164,7 +184,19 @@ class AliFlowBayesianPID : public AliPIDResponse{
 
   static TH1D *fgHtofChannelDist; // channel distance from IP
 
-  ClassDef(AliFlowBayesianPID, 10); // example of analysis
+  static const Int_t fgkNpriorPtBins = 80; // number of pT bins of the prior histos
+  Float_t fTableCentrality; //! centrality the tables below were filled for
+  Float_t fPriorTable[fgkNpriorPtBins+2][fgkNspecies]; //! priors per pT bin (incl. under/overflow) at fTableCentrality
+  Float_t fTPCResScale; //! TPC resolution correction at fTableCentrality
+  Float_t fTOFMismFrac; //! TOF mismatch fraction at fTableCentrality
+  Double_t fTPCResponsePar[4]; //! parameters of fTPCResponseF
+  Double_t fTOFResponsePar[4]; //! parameters of fTOFResponseF
+
+  std::vector<Float_t> fEventProb; //! probabilities of the tracks of the event [track][species]
+  std::vector<Float_t> fEventProbTofMism; //! TOF mismatch probability of the tracks of the event
+  std::vector<UChar_t> fEventMask; //! detector mask of the tracks of the event
+
+  ClassDef(AliFlowBayesianPID, 11); // example of analysis
 };
 
 #endif
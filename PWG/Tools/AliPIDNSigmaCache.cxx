@@ -0,0 +1,162 @@
+/**************************************************************************
+ * Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-----------------------------------------------------------------
+//         AliPIDNSigmaCache class
+//-----------------------------------------------------------------
+
+#include <algorithm>
+
+#include "AliPIDNSigmaCache.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+
+ClassImp(AliPIDNSigmaCache)
+
+AliPIDNSigmaCache* AliPIDNSigmaCache::fgInstance = 0x0;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+AliPIDNSigmaCache::AliPIDNSigmaCache() : TObject(),
+  fPIDResponse(0x0),
+  fEvent(0x0),
+  fEntry(-1),
+  fNSlots(0),
+  fNSigma(),
+  fComputed(),
+  fTrack(),
+  fNComputed(0),
+  fNRequests(0)
+{
+  // constructor
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+AliPIDNSigmaCache* AliPIDNSigmaCache::Instance(){
+  // returns the instance shared by all the tasks
+  if(!fgInstance) fgInstance = new AliPIDNSigmaCache();
+  return fgInstance;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AliPIDNSigmaCache::Reset(){
+  // forget the values of the current event, memory is kept
+  std::fill(fComputed.begin(), fComputed.begin()+fNSlots, 0ULL);
+  std::fill(fTrack.begin(), fTrack.begin()+fNSlots, (const AliVParticle*)0x0);
+  fNSlots = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+Bool_t AliPIDNSigmaCache::CheckEvent(AliPIDResponse *pid){
+  // check that pid is the shared PID response and reset the cache when the event changed
+  // returns kFALSE if the values cannot be cached
+  AliAnalysisManager *man = AliAnalysisManager::GetAnalysisManager();
+  if(!man) return kFALSE;
+  AliInputEventHandler *inputHandler = dynamic_cast<AliInputEventHandler*>(man->GetInputEventHandler());
+  if(!inputHandler) return kFALSE;
+  AliPIDResponse *shared = inputHandler->GetPIDResponse();
+  if(!shared || (pid && pid != shared)) return kFALSE;
+
+  const AliVEvent *event = inputHandler->GetEvent();
+  Long64_t entry = man->GetCurrentEntry();
+  if(shared != fPIDResponse || event != fEvent || entry != fEntry){
+    Reset();
+    fPIDResponse = shared;
+    fEvent = event;
+    fEntry = entry;
+  }
+  return kTRUE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+Int_t AliPIDNSigmaCache::GetSlot(const AliVParticle *track){
+  // slot of the track in the cache, from its ID (negative IDs for TPC only AOD tracks),
+  // the values of the slot are dropped if they belong to another object with the same ID
+  // returns -1 if the particle is not a track
+  const AliVTrack *trk = dynamic_cast<const AliVTrack*>(track);
+  if(!trk) return -1;
+  Int_t id = trk->GetID();
+  Int_t slot = (id >= 0) ? 2*id : -2*id-1;
+
+  if(slot >= (Int_t)fComputed.size()){
+    Int_t size = 2*(slot+1);
+    fComputed.resize(size, 0ULL);
+    fTrack.resize(size, 0x0);
+    fNSigma.resize(size*kNCacheDetectors*fgkNSpecies, -999.);
+  }
+  if(slot >= fNSlots) fNSlots = slot+1;
+  if(fTrack[slot] != track){
+    fTrack[slot] = track;
+    fComputed[slot] = 0ULL;
+  }
+  return slot;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+Float_t AliPIDNSigmaCache::GetNumberOfSigmas(AliPIDResponse::EDetector det, const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid){
+  // returns the n-sigma of track for species type in detector det,
+  // computed only at the first request in the event
+  fNRequests++;
+
+  Int_t idet = -1;
+  if(det == AliPIDResponse::kITS) idet = kCacheITS;
+  else if(det == AliPIDResponse::kTPC) idet = kCacheTPC;
+  else if(det == AliPIDResponse::kTOF) idet = kCacheTOF;
+
+  Int_t slot = -1;
+  if(idet >= 0 && type >= 0 && type < fgkNSpecies && CheckEvent(pid)) slot = GetSlot(track);
+
+  if(slot < 0){
+    // not cached: private PID response, other detector or no analysis manager
+    if(!pid && !CheckEvent(pid)) return -999.;
+    fNComputed++;
+    return (pid ? pid : fPIDResponse)->NumberOfSigmas(det, track, type);
+  }
+
+  Int_t ibit = idet*fgkNSpecies + type;
+  Int_t index = slot*kNCacheDetectors*fgkNSpecies + ibit;
+  if(!(fComputed[slot] & (1ULL << ibit))){
+    fNSigma[index] = fPIDResponse->NumberOfSigmas(det, track, type);
+    fComputed[slot] |= (1ULL << ibit);
+    fNComputed++;
+  }
+  return fNSigma[index];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AliPIDNSigmaCache::FillEvent(AliVEvent *event, Int_t nSpecies){
+  // compute in one pass the TPC and TOF n-sigma of all the tracks of the event
+  // for the first nSpecies species, to be called once per event (e.g. by the first wagon)
+  if(!event || !CheckEvent(0x0)) return;
+  if(nSpecies > fgkNSpecies) nSpecies = fgkNSpecies;
+
+  Int_t ntracks = event->GetNumberOfTracks();
+  for(Int_t itrk = 0; itrk < ntracks; itrk++){
+    AliVParticle *track = event->GetTrack(itrk);
+    if(!track) continue;
+    for(Int_t ispecie = 0; ispecie < nSpecies; ispecie++){
+      GetNumberOfSigmas(AliPIDResponse::kTPC, track, (AliPID::EParticleType)ispecie);
+      GetNumberOfSigmas(AliPIDResponse::kTOF, track, (AliPID::EParticleType)ispecie);
+    }
+  }
+}
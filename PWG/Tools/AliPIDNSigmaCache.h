@@ -0,0 +1,83 @@
+#ifndef ALIPIDNSIGMACACHE_H
+#define ALIPIDNSIGMACACHE_H
+
+class AliVEvent;
+class AliVParticle;
+
+#include <vector>
+#include "TObject.h"
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+//-----------------------------------------------------------------
+//         AliPIDNSigmaCache class
+//
+// Event-scoped cache of the n-sigma values of the PID response
+// registered in the input handler, shared by all the tasks of a train.
+//
+// The values are computed once per (track, detector, species) and
+// event, either lazily at the first request or in one pass over all
+// the tracks with FillEvent(). The slot of a track is found from its
+// ID and the values are kept only for the track object they were
+// computed for: a different object with the same ID (e.g. a TPC only
+// or constrained copy) gets its own values. ITS, TPC and TOF are
+// cached, other detectors and other PID response objects are
+// forwarded to AliPIDResponse.
+//
+// Usage in task code:
+//   Float_t nsTPC = AliPIDNSigmaCache::NumberOfSigmasTPC(track, AliPID::kPion);
+//-----------------------------------------------------------------
+
+class AliPIDNSigmaCache : public TObject
+{
+ public:
+
+  AliPIDNSigmaCache();
+  virtual ~AliPIDNSigmaCache() {}
+
+  static AliPIDNSigmaCache* Instance();
+
+  // shortcuts to the shared instance
+  static Float_t NumberOfSigmas(AliPIDResponse::EDetector det, const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid=0x0)
+    { return Instance()->GetNumberOfSigmas(det, track, type, pid); }
+  static Float_t NumberOfSigmasITS(const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid=0x0)
+    { return NumberOfSigmas(AliPIDResponse::kITS, track, type, pid); }
+  static Float_t NumberOfSigmasTPC(const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid=0x0)
+    { return NumberOfSigmas(AliPIDResponse::kTPC, track, type, pid); }
+  static Float_t NumberOfSigmasTOF(const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid=0x0)
+    { return NumberOfSigmas(AliPIDResponse::kTOF, track, type, pid); }
+
+  Float_t GetNumberOfSigmas(AliPIDResponse::EDetector det, const AliVParticle *track, AliPID::EParticleType type, AliPIDResponse *pid=0x0);
+  void    FillEvent(AliVEvent *event, Int_t nSpecies=AliPID::kSPECIES);
+  void    Reset();
+
+  Long64_t GetNComputed() const { return fNComputed; }
+  Long64_t GetNRequests() const { return fNRequests; }
+
+ private:
+
+  enum { kCacheITS = 0, kCacheTPC, kCacheTOF, kNCacheDetectors };
+  static const Int_t fgkNSpecies = AliPID::kSPECIESC; // number of cached species per detector
+
+  Bool_t  CheckEvent(AliPIDResponse *pid);
+  Int_t   GetSlot(const AliVParticle *track);
+
+  AliPIDNSigmaCache(const AliPIDNSigmaCache&); // not implemented
+  AliPIDNSigmaCache& operator=(const AliPIDNSigmaCache&); // not implemented
+
+  AliPIDResponse *fPIDResponse;         //! shared PID response the values belong to
+  const AliVEvent *fEvent;              //! event the values belong to
+  Long64_t fEntry;                      //! analysis manager entry the values belong to
+  Int_t    fNSlots;                     //! number of slots in use in the current event
+  std::vector<Float_t>   fNSigma;       //! n-sigma values [slot][detector][species]
+  std::vector<ULong64_t> fComputed;     //! bit (detector*fgkNSpecies+species) set if value computed [slot]
+  std::vector<const AliVParticle*> fTrack; //! track object the values of the slot belong to [slot]
+  Long64_t fNComputed;                  //! number of n-sigma computations done
+  Long64_t fNRequests;                  //! number of n-sigma requests
+
+  static AliPIDNSigmaCache *fgInstance; // shared instance
+
+  ClassDef(AliPIDNSigmaCache, 2);
+};
+
+#endif
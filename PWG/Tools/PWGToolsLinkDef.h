@@ -9,6 +9,7 @@
 #pragma link C++ class AliFigure+;
 #pragma link C++ class AliCanvas+;
 #pragma link C++ class AliHelperPID+;
+#pragma link C++ class AliPIDNSigmaCache+;
 #pragma link C++ class AliLatexTable+;
 #pragma link C++ class AliNamedArrayI+;
 #pragma link C++ class AliNamedString+;
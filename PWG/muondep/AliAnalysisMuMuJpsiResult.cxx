@@ -103,7 +103,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(""),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(-1.)
 {
 }
 
@@ -126,7 +127,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(-1.)
 {
   SetHisto(h);
 
@@ -198,7 +200,8 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactor(-1.)
 {
   SetHisto(h);
 }
@@ -220,7 +223,8 @@ fFitRejectRangeLow(rhs.fFitRejectRangeLow),
 fFitRejectRangeHigh(rhs.fFitRejectRangeHigh),
 fRejectFitPoints(rhs.fRejectFitPoints),
 fParticle(rhs.fParticle),
-fMinvRS(rhs.fMinvRS)
+fMinvRS(rhs.fMinvRS),
+fSPsiPFactor(-1.)
 {
   /// copy ctor
   /// Note that the mother is lost
@@ -260,6 +264,7 @@ AliAnalysisMuMuJpsiResult& AliAnalysisMuMuJpsiResult::operator=(const AliAnalysi
     fRejectFitPoints     = rhs.fRejectFitPoints;
     fParticle            = rhs.fParticle;
     fMinvRS              = rhs.fMinvRS;
+    fSPsiPFactor         = -1.;
 
   }
 
@@ -661,7 +666,9 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionNA60New(Double_t *x,Double_t *par
   else if( t >= par[9] && t < par[10] ) sigmaRatio = 1;
   else if( t >= par[10] ) sigmaRatio = ( 1.0 + TMath::Power( par[6]*(t-par[10]), par[7]-par[8]*TMath::Sqrt(t - par[10]) ) );
 
-  return par[0]*TMath::Exp( -(1/2.)*TMath::Power(t/sigmaRatio,2.));
+  const Double_t tOverSigmaRatio = t/sigmaRatio;
+
+  return par[0]*TMath::Exp( -(1/2.)*tOverSigmaRatio*tOverSigmaRatio);
 
 }
 
@@ -671,7 +678,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG(Double_t *x, D
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
@@ -695,7 +702,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG2(Double_t *x,
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
@@ -719,7 +726,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol1Pol2(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
@@ -743,7 +750,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Pol3(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[18],
@@ -767,7 +774,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Exp(Double_t *
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
@@ -792,7 +799,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol4Exp(Double_t *
   /// 2 NA60 (new) + pol4 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[17],
@@ -816,7 +823,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Lin(Double_t *x, Doubl
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[9],
@@ -836,7 +843,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol1Pol2(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
@@ -856,7 +863,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[14],
@@ -876,7 +883,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3V2(Double_t *x
   /// 2 extended crystal balls + Pol2/pol3
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
@@ -896,7 +903,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Exp(Double_t *x, D
   /// 2 extended crystal balls + pol2 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -934,7 +941,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol4Exp(Double_t *x, D
   /// 2 extended crystal balls + pol4 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
@@ -972,7 +979,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG(Double_t *x, Doubl
   /// 2 extended crystal balls + VWG
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -992,7 +999,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG2(Double_t *x, Doub
   /// 2 extended crystal balls + VWG2
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
@@ -1012,7 +1019,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWGINDEPTAILS(Double_t
   /// 2 extended crystal balls + pol2 x exp
   /// The tail parameters are independent but the sPsiP and mPsiP are fixed to the one of the JPsi
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
@@ -1082,7 +1089,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2Lin(Double_t* x, Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2Lin(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1114,7 +1121,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2VWGPOL2(Double_t* x, Do
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1138,7 +1145,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[12] = {
     par[0],
@@ -1163,7 +1170,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2(Double_t
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1187,7 +1194,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[12] = {
     par[0],
@@ -1212,7 +1219,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL1POL2POL2EXP(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1237,7 +1244,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1262,7 +1269,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1290,7 +1297,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[16] = {
     par[0],//a
@@ -1319,7 +1326,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2(Doubl
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1348,7 +1355,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[16] = {
     par[0],
@@ -1378,7 +1385,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL1POL2POL2EXP(Do
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1406,7 +1413,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1448,7 +1455,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtHFunction(Double_t *x, Doub
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1472,7 +1479,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1496,7 +1503,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2INDEPTAILS(Double_t* x, Double_t* par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP with independent tails
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t SPsiPFactor = GetSPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -8333,6 +8340,7 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
 
   if (callEnv.IsValid())
   {
+    r->fSPsiPFactor = -1.;
     callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
   }
   else
@@ -8489,6 +8497,7 @@ void AliAnalysisMuMuJpsiResult::DecodeFitType(const char* fitType)
     fFitFunction = fitFunction;
 
     Set(kKeySPsiP,paramSPsiP,0.0);
+    fSPsiPFactor = -1.;
     Set(kKeyRebin,rebin,0.0);
     Set(kFitRangeLow,fitMinvMin,0.0);
     Set(kFitRangeHigh,fitMinvMax,0.0);
@@ -9151,6 +9160,17 @@ Bool_t AliAnalysisMuMuJpsiResult::CheckRoots(TFitResultPtr &fitResult, TF1* fitF
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::GetSPsiPFactor()
+{
+  /// FSigmaPsiP factor used by the fit functions.
+  /// The fit functions are evaluated for each bin at each step of the minimization,
+  /// so the value is looked up in the map only once and cached.
+
+  if ( fSPsiPFactor < 0 ) fSPsiPFactor = GetValue(kKeySPsiP);
+  return fSPsiPFactor;
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuJpsiResult::StrongCorrelation(TFitResultPtr& r,
                                                     TF1* fitFunction,
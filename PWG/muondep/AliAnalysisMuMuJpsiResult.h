@@ -306,6 +306,8 @@ private:
 
   Bool_t WrongParameter(TF1* fitFunction, Int_t npar, Double_t fixValueIfWrong);
 
+  Double_t GetSPsiPFactor();
+
   Bool_t StrongCorrelation(TFitResultPtr& fitResult, TF1* fitFunction, Int_t npar1, Int_t npar2, Double_t fixValueIfWrong);
 
 
@@ -328,7 +330,9 @@ private:
   TString fParticle;
   TString fMinvRS; // minv spectra range and sigmaPsiP factor for the mpt fits
 
-  ClassDef(AliAnalysisMuMuJpsiResult,8) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
+  Double_t fSPsiPFactor; //! cached FSigmaPsiP value used by the fit functions, negative if not yet read
+
+  ClassDef(AliAnalysisMuMuJpsiResult,9) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
 };
 
 #endif
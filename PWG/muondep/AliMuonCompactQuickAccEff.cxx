@@ -12,9 +12,130 @@
 #include "TMath.h"
 #include "TParameter.h"
 #include "TTree.h"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
+namespace
+{
+    /// Flat index of the tracks and of the pairs counted by ComputeMinv,
+    /// used to replay the manu status of consecutive runs incrementally
+    struct CompactTrackIndex
+    {
+        std::vector<const AliMuonCompactTrack*> mTracks; ///< all the tracks of the considered events
+        std::vector<int> mPairTrack1; ///< first track of the pairs within the rapidity range
+        std::vector<int> mPairTrack2; ///< second track of the pairs within the rapidity range
+        std::vector<int> mTrackPairFirst; ///< pairs of track i are mTrackPairs[mTrackPairFirst[i]..mTrackPairFirst[i+1]-1]
+        std::vector<int> mTrackPairs;
+        std::vector<int> mManuTrackFirst; ///< tracks with a cluster on manu m are mManuTracks[mManuTrackFirst[m]..mManuTrackFirst[m+1]-1]
+        std::vector<int> mManuTracks;
+    };
+
+    /// Validity of the tracks and pairs for one cause mask
+    struct CompactTrackValidity
+    {
+        CompactTrackValidity() : mTrackValid(), mPairValid(), mNofValidTracks(0), mNofValidPairs(0) {}
+        std::vector<char> mTrackValid;
+        std::vector<char> mPairValid;
+        int mNofValidTracks;
+        int mNofValidPairs;
+    };
+
+    /// Build the track, pair and manu index of the first maxevents events
+    void BuildTrackIndex(const std::vector<AliMuonCompactEvent>& events,
+            uint64_t maxevents, CompactTrackIndex& index)
+    {
+        const double m2 = 0.1056584*0.1056584;
+
+        int nmanus = 0;
+        std::vector<int> eventFirstTrack;
+
+        for ( std::vector<AliMuonCompactEvent>::size_type i = 0; i < maxevents; ++i )
+        {
+            const AliMuonCompactEvent& e = events[i];
+            int first = index.mTracks.size();
+
+            for ( std::vector<AliMuonCompactTrack>::size_type j = 0; j < e.mTracks.size(); ++j )
+            {
+                const AliMuonCompactTrack& t = e.mTracks[j];
+                index.mTracks.push_back(&t);
+                for ( std::vector<AliMuonCompactCluster>::size_type c = 0; c < t.mClusters.size(); ++c )
+                {
+                    nmanus = std::max(nmanus,t.mClusters[c].BendingManuIndex()+1);
+                    nmanus = std::max(nmanus,t.mClusters[c].NonBendingManuIndex()+1);
+                }
+            }
+
+            // same pair kinematics as in ComputeMinv
+            for ( std::vector<AliMuonCompactTrack>::size_type j = 0; j < e.mTracks.size(); ++j )
+            {
+                const AliMuonCompactTrack& t1 = e.mTracks[j];
+                for ( std::vector<AliMuonCompactTrack>::size_type k = j+1; k < e.mTracks.size(); ++k )
+                {
+                    const AliMuonCompactTrack& t2 = e.mTracks[k];
+
+                    double p1square = t1.mPx*t1.mPx + t1.mPy*t1.mPy + t1.mPz*t1.mPz;
+                    double p2square = t2.mPx*t2.mPx + t2.mPy*t2.mPy + t2.mPz*t2.mPz;
+                    double e12 = sqrt(m2+p1square+p2square+2.0*sqrt(p1square)*sqrt(p2square));
+                    double pz = t1.mPz+t2.mPz;
+                    double y = 0.5*log( (e12+pz) / (e12-pz) );
+
+                    if (y >= -4 && y <= -2.5 )
+                    {
+                        index.mPairTrack1.push_back(first+j);
+                        index.mPairTrack2.push_back(first+k);
+                    }
+                }
+            }
+        }
+
+        const int ntracks = index.mTracks.size();
+        const int npairs = index.mPairTrack1.size();
+
+        // track -> pairs
+        index.mTrackPairFirst.assign(ntracks+1,0);
+        for ( int p = 0; p < npairs; ++p )
+        {
+            ++index.mTrackPairFirst[index.mPairTrack1[p]+1];
+            ++index.mTrackPairFirst[index.mPairTrack2[p]+1];
+        }
+        for ( int t = 0; t < ntracks; ++t ) index.mTrackPairFirst[t+1] += index.mTrackPairFirst[t];
+        index.mTrackPairs.resize(2*npairs);
+        std::vector<int> fill(index.mTrackPairFirst.begin(),index.mTrackPairFirst.end()-1);
+        for ( int p = 0; p < npairs; ++p )
+        {
+            index.mTrackPairs[fill[index.mPairTrack1[p]]++] = p;
+            index.mTrackPairs[fill[index.mPairTrack2[p]]++] = p;
+        }
+
+        // manu -> tracks (a track is listed once per cluster touching the manu)
+        index.mManuTrackFirst.assign(nmanus+1,0);
+        for ( int t = 0; t < ntracks; ++t )
+        {
+            const AliMuonCompactTrack& track = *index.mTracks[t];
+            for ( std::vector<AliMuonCompactCluster>::size_type c = 0; c < track.mClusters.size(); ++c )
+            {
+                const AliMuonCompactCluster& cl = track.mClusters[c];
+                if ( cl.BendingManuIndex() >= 0 ) ++index.mManuTrackFirst[cl.BendingManuIndex()+1];
+                if ( cl.NonBendingManuIndex() >= 0 ) ++index.mManuTrackFirst[cl.NonBendingManuIndex()+1];
+            }
+        }
+        for ( int m = 0; m < nmanus; ++m ) index.mManuTrackFirst[m+1] += index.mManuTrackFirst[m];
+        index.mManuTracks.resize(index.mManuTrackFirst[nmanus]);
+        fill.assign(index.mManuTrackFirst.begin(),index.mManuTrackFirst.end()-1);
+        for ( int t = 0; t < ntracks; ++t )
+        {
+            const AliMuonCompactTrack& track = *index.mTracks[t];
+            for ( std::vector<AliMuonCompactCluster>::size_type c = 0; c < track.mClusters.size(); ++c )
+            {
+                const AliMuonCompactCluster& cl = track.mClusters[c];
+                if ( cl.BendingManuIndex() >= 0 ) index.mManuTracks[fill[cl.BendingManuIndex()]++] = t;
+                if ( cl.NonBendingManuIndex() >= 0 ) index.mManuTracks[fill[cl.NonBendingManuIndex()]++] = t;
+            }
+        }
+    }
+}
+
 /// \ingroup compact
 AliMuonCompactQuickAccEff::AliMuonCompactQuickAccEff(int maxevents, bool rejectMonoCathodeClusters)
     : fMaxEvents(maxevents), fRejectMonoCathodeClusters(rejectMonoCathodeClusters)
@@ -320,6 +441,21 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
         g->SetMarkerSize(1.5);
     }
 
+    // The pair counts for each run are obtained by replaying the manu status of the run
+    // against an index of the tracks and of the pairs within the rapidity range.
+    // From one run to the next only the tracks with clusters on manus whose
+    // status changed (for the given cause) are re-validated.
+    uint64_t maxevents = fMaxEvents;
+    if (!maxevents) maxevents = events.size();
+
+    CompactTrackIndex index;
+    BuildTrackIndex(events,maxevents,index);
+
+    std::vector<CompactTrackValidity> validity(causes.size());
+    const std::vector<UInt_t>* previousManuStatus = 0x0;
+    std::vector<int> trackStamp(index.mTracks.size(),-1);
+    std::vector<int> dirtyTracks;
+
     for ( std::vector<int>::size_type i = 0; i < vrunlist.size(); ++i )
     {
         Int_t runNumber = vrunlist[i];
@@ -330,6 +466,9 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
 
         const std::vector<UInt_t>& manustatus = it->second; 
 
+        Bool_t fullReplay = ( !previousManuStatus || previousManuStatus->size() != manustatus.size() ||
+                manustatus.empty() );
+
         for ( std::vector<UInt_t>::size_type icause = 0; icause < causes.size(); ++icause )
         {
             auto nbad =std::count_if(manustatus.begin(),
@@ -340,22 +479,65 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
                 AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str(),
                 nbad
                 );
-            Int_t npairs(0);
-            TH1* h = ComputeMinv(events,manustatus,causes[icause],npairs);
-            if (h)
-            {
-                h->SetName(Form("hminv%6d%s",runNumber,AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str()));
-                hminv.push_back(h); 
-            }
-            Double_t drop = 0.0;
-            if ( h) 
+            CompactTrackValidity& v = validity[icause];
+
+            if ( fullReplay )
             {
-                drop = 100.0*(1.0-h->Integral(b1,b2)/referenceNofJpsi);
+                v.mTrackValid.resize(index.mTracks.size());
+                v.mNofValidTracks = 0;
+                for ( std::vector<const AliMuonCompactTrack*>::size_type t = 0; t < index.mTracks.size(); ++t )
+                {
+                    v.mTrackValid[t] = ValidateTrack(*index.mTracks[t],manustatus,causes[icause]);
+                    v.mNofValidTracks += v.mTrackValid[t];
+                }
+                v.mPairValid.resize(index.mPairTrack1.size());
+                v.mNofValidPairs = 0;
+                for ( std::vector<int>::size_type p = 0; p < index.mPairTrack1.size(); ++p )
+                {
+                    v.mPairValid[p] = ( v.mTrackValid[index.mPairTrack1[p]] && v.mTrackValid[index.mPairTrack2[p]] );
+                    v.mNofValidPairs += v.mPairValid[p];
+                }
             }
             else
             {
-                drop = 100.0*(1.0 - npairs*1.0/referenceNofJpsi);
+                // collect the tracks touching a manu which changed from good to bad or bad to good
+                dirtyTracks.clear();
+                const Int_t stamp = i*causes.size()+icause;
+                const Int_t nmanus = std::min(manustatus.size(),index.mManuTrackFirst.size()-1);
+                for ( Int_t m = 0; m < nmanus; ++m )
+                {
+                    if ( ( ( (*previousManuStatus)[m] & causes[icause] ) == 0 ) ==
+                         ( ( manustatus[m] & causes[icause] ) == 0 ) ) continue;
+                    for ( Int_t k = index.mManuTrackFirst[m]; k < index.mManuTrackFirst[m+1]; ++k )
+                    {
+                        Int_t t = index.mManuTracks[k];
+                        if ( trackStamp[t] == stamp ) continue;
+                        trackStamp[t] = stamp;
+                        dirtyTracks.push_back(t);
+                    }
+                }
+
+                for ( std::vector<int>::size_type d = 0; d < dirtyTracks.size(); ++d )
+                {
+                    Int_t t = dirtyTracks[d];
+                    char valid = ValidateTrack(*index.mTracks[t],manustatus,causes[icause]);
+                    if ( valid == v.mTrackValid[t] ) continue;
+                    v.mTrackValid[t] = valid;
+                    v.mNofValidTracks += ( valid ? 1 : -1 );
+                    for ( Int_t k = index.mTrackPairFirst[t]; k < index.mTrackPairFirst[t+1]; ++k )
+                    {
+                        Int_t p = index.mTrackPairs[k];
+                        char pairValid = ( v.mTrackValid[index.mPairTrack1[p]] && v.mTrackValid[index.mPairTrack2[p]] );
+                        v.mNofValidPairs += pairValid - v.mPairValid[p];
+                        v.mPairValid[p] = pairValid;
+                    }
+                }
             }
+
+            Int_t npairs = v.mNofValidPairs;
+            std::cout << Form("nTracks %d nValidated %d npairs %d",(Int_t)index.mTracks.size(),
+                    v.mNofValidTracks,npairs) << std::endl;
+            Double_t drop = 100.0*(1.0 - npairs*1.0/referenceNofJpsi);
             Double_t relativeError = TMath::Sqrt(1.0/npairs + 1.0/referenceNofJpsi);
             Double_t dropError = drop*relativeError;
             std::cout << Form("RUN %6d %30s AccxEff drop %7.2f %% +- %5.2f %%",
@@ -363,6 +545,8 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
             gdrop[icause]->SetPoint(i,runNumber,drop);
             gdrop[icause]->SetPointError(i,0.0,dropError);
         }
+
+        previousManuStatus = &manustatus;
     }
 
 
@@ -47,6 +47,8 @@ The names are available via the function PairClassName(Int_t i)
 #include <TMath.h>
 #include <TObject.h>
 #include <TGrid.h>
+#include <TDatabasePDG.h>
+#include <TParticlePDG.h>
 
 #include <AliKFParticle.h>
 
@@ -158,6 +160,16 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPreselection(kFALSE),
+  fPreselMassMin(-1e30),
+  fPreselMassMax(1e30),
+  fPreselPtMin(-1e30),
+  fPreselPtMax(1e30),
+  fPreselOpAngleMin(-1e30),
+  fPreselOpAngleMax(1e30),
+  fPreselPhivMin(-1e30),
+  fPreselPhivMax(1e30),
+  fPreselPass(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -233,6 +245,16 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fPairPreselection(kFALSE),
+  fPreselMassMin(-1e30),
+  fPreselMassMax(1e30),
+  fPreselPtMin(-1e30),
+  fPreselPtMax(1e30),
+  fPreselOpAngleMin(-1e30),
+  fPreselOpAngleMax(1e30),
+  fPreselPhivMin(-1e30),
+  fPreselPhivMax(1e30),
+  fPreselPass(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -1404,10 +1426,20 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  // kinematic pre-selection, only if the rejected pairs are not needed by the CF manager or the cut QA
+  Bool_t preselection=fPairPreselection && !fCfManagerPair && !(pairIndex==kEv1PM && fCutQA);
+  if (preselection){
+    FillLegKinematics(arrTracks1, fPdgLeg1, fLegKine[0]);
+    FillLegKinematics(arrTracks2, fPdgLeg2, fLegKine[1]);
+    if ((Int_t)fPreselPass.size()<ntrack2) fPreselPass.resize(ntrack2);
+  }
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
+    if (preselection && end>0) PairPreselection(&fLegKine[0][itrack1*kNLegKine], &fLegKine[1][0], end, &fPreselPass[0]);
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
+      if (preselection && !fPreselPass[itrack2]) continue;
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
       candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
                            &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
@@ -1462,9 +1494,18 @@ void AliDielectron::FillPairArrayTR()
   // select pairs and fill pair candidate arrays
   //
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
+  Bool_t preselection=fPairPreselection && !fCfManagerPair;
+  Double_t legP[kNLegKine], legN[kNLegKine];
 
   while ( fTrackRotator->NextCombination() ){
     if(fTrackRotator->SameTracks() ) continue;
+    if (preselection){
+      const AliKFParticle &kfP=fTrackRotator->GetKFTrackP();
+      const AliKFParticle &kfN=fTrackRotator->GetKFTrackN();
+      legP[kLegPx]=kfP.GetPx(); legP[kLegPy]=kfP.GetPy(); legP[kLegPz]=kfP.GetPz(); legP[kLegE]=kfP.GetE(); legP[kLegQ]=kfP.GetQ();
+      legN[kLegPx]=kfN.GetPx(); legN[kLegPy]=kfN.GetPy(); legN[kLegPz]=kfN.GetPz(); legN[kLegE]=kfN.GetE(); legN[kLegQ]=kfN.GetQ();
+      if (!PairPreselected(legP,legN)) continue;
+    }
     AliDielectronPair candidate;
     candidate.SetKFUsage(fUseKF);
     candidate.SetTracks(&fTrackRotator->GetKFTrackP(), &fTrackRotator->GetKFTrackN(),
@@ -1489,6 +1530,119 @@ void AliDielectron::FillPairArrayTR()
   }
 }
 
+//________________________________________________________________
+void AliDielectron::FillLegKinematics(const TObjArray &arrTracks, Int_t pdg, std::vector<Double_t> &kine) const
+{
+  //
+  // store px, py, pz, E (leg mass hypothesis) and charge of the tracks
+  // in a flat array, kNLegKine values per track
+  //
+  TParticlePDG *part=TDatabasePDG::Instance()->GetParticle(pdg);
+  Double_t mass2=part ? part->Mass()*part->Mass() : 0.;
+
+  Int_t ntracks=arrTracks.GetEntriesFast();
+  if ((Int_t)kine.size()<ntracks*kNLegKine) kine.resize(ntracks*kNLegKine);
+  for (Int_t itrack=0; itrack<ntracks; ++itrack){
+    const AliVTrack *track=static_cast<const AliVTrack*>(arrTracks.UncheckedAt(itrack));
+    Double_t *leg=&kine[itrack*kNLegKine];
+    leg[kLegPx]=track->Px();
+    leg[kLegPy]=track->Py();
+    leg[kLegPz]=track->Pz();
+    leg[kLegE] =TMath::Sqrt(leg[kLegPx]*leg[kLegPx]+leg[kLegPy]*leg[kLegPy]+leg[kLegPz]*leg[kLegPz]+mass2);
+    leg[kLegQ] =track->Charge();
+  }
+}
+
+//________________________________________________________________
+void AliDielectron::PairPreselection(const Double_t *leg1, const Double_t *legs2, Int_t nlegs2, UChar_t *pass) const
+{
+  //
+  // evaluate the pre-selection of leg1 combined with the first nlegs2 legs of legs2
+  // mass, pt and opening angle are computed for all combinations in one loop,
+  // phiv only for the combinations passing them
+  //
+  const Double_t px1=leg1[kLegPx], py1=leg1[kLegPy], pz1=leg1[kLegPz], e1=leg1[kLegE];
+  const Double_t p1=TMath::Sqrt(px1*px1+py1*py1+pz1*pz1);
+  const Double_t mass2Min=fPreselMassMin>0 ? fPreselMassMin*fPreselMassMin : -1e30;
+  const Double_t mass2Max=fPreselMassMax<1e15 ? fPreselMassMax*fPreselMassMax : 1e30;
+  const Double_t pt2Min=fPreselPtMin>0 ? fPreselPtMin*fPreselPtMin : -1e30;
+  const Double_t pt2Max=fPreselPtMax<1e15 ? fPreselPtMax*fPreselPtMax : 1e30;
+  // opening angle window as a window in cos(angle), reversed order
+  const Double_t cosMax=fPreselOpAngleMin>0 ? TMath::Cos(TMath::Min(fPreselOpAngleMin,TMath::Pi())) : 2.;
+  const Double_t cosMin=fPreselOpAngleMax<TMath::Pi() ? TMath::Cos(TMath::Max(fPreselOpAngleMax,0.)) : -2.;
+
+  for (Int_t i=0; i<nlegs2; ++i){
+    const Double_t *leg2=&legs2[i*kNLegKine];
+    const Double_t px=px1+leg2[kLegPx], py=py1+leg2[kLegPy], pz=pz1+leg2[kLegPz], e=e1+leg2[kLegE];
+    const Double_t m2=e*e-px*px-py*py-pz*pz;
+    const Double_t pt2=px*px+py*py;
+    const Double_t p2=TMath::Sqrt(leg2[kLegPx]*leg2[kLegPx]+leg2[kLegPy]*leg2[kLegPy]+leg2[kLegPz]*leg2[kLegPz]);
+    const Double_t pp=p1*p2;
+    const Double_t cosAngle=pp>0 ? (px1*leg2[kLegPx]+py1*leg2[kLegPy]+pz1*leg2[kLegPz])/pp : 1.;
+    pass[i]=(m2>=mass2Min) & (m2<=mass2Max) & (pt2>=pt2Min) & (pt2<=pt2Max) & (cosAngle<=cosMax) & (cosAngle>=cosMin);
+  }
+
+  if (fPreselPhivMin<=0. && fPreselPhivMax>=TMath::Pi()) return;
+  // the ordering of like-sign legs is random, phiv cannot be pre-selected
+  if (AliDielectronPair::GetRandomizeDaughters()) return;
+  AliVEvent *ev=AliDielectronVarManager::GetCurrentEvent();
+  if (!ev) return;
+  const Double_t magField=ev->GetMagneticField();
+  for (Int_t i=0; i<nlegs2; ++i){
+    if (!pass[i]) continue;
+    Double_t phiv=PairPhiv(leg1,&legs2[i*kNLegKine],magField);
+    pass[i]=(phiv>=fPreselPhivMin && phiv<=fPreselPhivMax);
+  }
+}
+
+//________________________________________________________________
+Bool_t AliDielectron::PairPreselected(const Double_t *leg1, const Double_t *leg2) const
+{
+  //
+  // pre-selection of a single leg combination
+  //
+  UChar_t pass=0;
+  PairPreselection(leg1, leg2, 1, &pass);
+  return pass;
+}
+
+//________________________________________________________________
+Double_t AliDielectron::PairPhiv(const Double_t *leg1, const Double_t *leg2, Double_t magField)
+{
+  //
+  // phiv of the leg combination, same definition and leg ordering
+  // as AliDielectronPair::PhivPair (daughters sorted by pt)
+  //
+  const Double_t pt1=leg1[kLegPx]*leg1[kLegPx]+leg1[kLegPy]*leg1[kLegPy];
+  const Double_t pt2=leg2[kLegPx]*leg2[kLegPx]+leg2[kLegPy]*leg2[kLegPy];
+  const Double_t *d1=pt1>pt2 ? leg1 : leg2;
+  const Double_t *d2=pt1>pt2 ? leg2 : leg1;
+
+  // regular order for unlike sign in positive field, inverted for like sign
+  Bool_t likeSign=d1[kLegQ]*d2[kLegQ]>0.;
+  Bool_t regular=likeSign ? magField<0 : magField>0;
+  const Double_t *a=((d1[kLegQ]>0)==regular) ? d1 : d2;
+  const Double_t *b=(a==d1) ? d2 : d1;
+
+  Double_t px=a[kLegPx]+b[kLegPx];
+  Double_t py=a[kLegPy]+b[kLegPy];
+  Double_t pz=a[kLegPz]+b[kLegPz];
+  Double_t pl=TMath::Sqrt(px*px+py*py+pz*pz);
+  Double_t ux=px/pl, uy=py/pl, uz=pz/pl;
+  Double_t ax=uy/TMath::Sqrt(ux*ux+uy*uy);
+  Double_t ay=-ux/TMath::Sqrt(ux*ux+uy*uy);
+
+  Double_t vpx=a[kLegPy]*b[kLegPz]-a[kLegPz]*b[kLegPy];
+  Double_t vpy=a[kLegPz]*b[kLegPx]-a[kLegPx]*b[kLegPz];
+  Double_t vpz=a[kLegPx]*b[kLegPy]-a[kLegPy]*b[kLegPx];
+  Double_t vp=TMath::Sqrt(vpx*vpx+vpy*vpy+vpz*vpz);
+  Double_t vx=vpx/vp, vy=vpy/vp, vz=vpz/vp;
+
+  Double_t wx=uy*vz-uz*vy;
+  Double_t wy=uz*vx-ux*vz;
+  return TMath::ACos(wx*ax+wy*ay);
+}
+
 //________________________________________________________________
 void AliDielectron::FillDebugTree()
 {
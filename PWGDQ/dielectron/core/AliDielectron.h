@@ -20,6 +20,7 @@
 #include <TObjArray.h>
 #include <THnBase.h>
 #include <TSpline.h>
+#include <vector>
 
 #include <AliAnalysisFilter.h>
 #include <AliKFParticle.h>
@@ -141,6 +142,14 @@ public:
   Bool_t GetHasMC() const     { return fHasMC;  }
 
   void SetStoreRotatedPairs(Bool_t storeTR) {fStoreRotatedPairs = storeTR;}
+
+  // kinematic pre-selection of the leg combinations, evaluated before the pair candidates are built
+  // the windows must be looser than the corresponding pair cuts, it is not used if the pair CF manager
+  // or the cut QA need the rejected pairs
+  void SetPairPreselectionMass(Double_t min, Double_t max)         { fPreselMassMin=min;    fPreselMassMax=max;    fPairPreselection=kTRUE; }
+  void SetPairPreselectionPt(Double_t min, Double_t max)           { fPreselPtMin=min;      fPreselPtMax=max;      fPairPreselection=kTRUE; }
+  void SetPairPreselectionOpeningAngle(Double_t min, Double_t max) { fPreselOpAngleMin=min; fPreselOpAngleMax=max; fPairPreselection=kTRUE; }
+  void SetPairPreselectionPhiv(Double_t min, Double_t max)         { fPreselPhivMin=min;    fPreselPhivMax=max;    fPairPreselection=kTRUE; }
   void SetDontClearArrays(Bool_t dontClearArrays=kTRUE) { fDontClearArrays=dontClearArrays; }
   Bool_t DontClearArrays() const { return fDontClearArrays; }
 
@@ -265,12 +274,30 @@ private:
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
 
+  Bool_t   fPairPreselection;   // apply the kinematic pair pre-selection
+  Double_t fPreselMassMin;      // pre-selection: minimum pair mass
+  Double_t fPreselMassMax;      // pre-selection: maximum pair mass
+  Double_t fPreselPtMin;        // pre-selection: minimum pair pt
+  Double_t fPreselPtMax;        // pre-selection: maximum pair pt
+  Double_t fPreselOpAngleMin;   // pre-selection: minimum opening angle
+  Double_t fPreselOpAngleMax;   // pre-selection: maximum opening angle
+  Double_t fPreselPhivMin;      // pre-selection: minimum phiv
+  Double_t fPreselPhivMax;      // pre-selection: maximum phiv
+  std::vector<Double_t> fLegKine[2];  //! px, py, pz, E, charge of the tracks of the two pairing arrays
+  std::vector<UChar_t>  fPreselPass;  //! pre-selection result of the combinations of one leg1 track
+
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
   void PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1, TObjArray &arrTracks2, const AliVEvent *ev, Int_t prefilterN);
   void FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev = 0x0);
   void FillPairArrayTR();
 
+  enum { kLegPx=0, kLegPy, kLegPz, kLegE, kLegQ, kNLegKine };
+  void FillLegKinematics(const TObjArray &arrTracks, Int_t pdg, std::vector<Double_t> &kine) const;
+  void PairPreselection(const Double_t *leg1, const Double_t *legs2, Int_t nlegs2, UChar_t *pass) const;
+  Bool_t PairPreselected(const Double_t *leg1, const Double_t *leg2) const;
+  static Double_t PairPhiv(const Double_t *leg1, const Double_t *leg2, Double_t magField);
+
   Int_t GetPairIndex(Int_t arr1, Int_t arr2) const {return arr1>=arr2?arr1*(arr1+1)/2+arr2:arr2*(arr2+1)/2+arr1;}
 
   void InitPairCandidateArrays();
@@ -303,7 +330,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
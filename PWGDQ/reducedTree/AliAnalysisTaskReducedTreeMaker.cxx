@@ -89,6 +89,7 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker() :
   fRejectPileup(kFALSE),
   fTreeWritingOption(kBaseEventsWithBaseTracks),
   fWriteTree(kTRUE),
+  fTreeBasketSize(16000),
   fWriteEventsWithNoSelectedTracks(kTRUE),
   fFillTrackInfo(kTRUE),
   fFillV0Info(kTRUE),
@@ -145,6 +146,7 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker(const char *nam
   fRejectPileup(kFALSE),
   fTreeWritingOption(kBaseEventsWithBaseTracks),
   fWriteTree(writeTree),
+  fTreeBasketSize(16000),
   fWriteEventsWithNoSelectedTracks(kTRUE),
   fFillTrackInfo(kTRUE),
   fFillV0Info(kTRUE),
@@ -231,8 +233,11 @@ void AliAnalysisTaskReducedTreeMaker::UserCreateOutputObjects()
         break;
   };
  
+  // NOTE: the event branch is fully split (split level 99), such that every data member of the tracks, pairs, clusters, etc.
+  //       is written in its own branch, as a flat array over the objects of the event, and can be read independently
+  //       (see AliReducedEventInputHandler::AddReadTrackField())
   if(fWriteTree)
-    fTree->Branch("Event",&fReducedEvent,16000,99);
+    fTree->Branch("Event",&fReducedEvent,fTreeBasketSize,99);
 
   // if user set active branches
   TObjArray* aractive=fActiveBranches.Tokenize(";");
@@ -82,6 +82,8 @@ public:
   // Suppress writing the tree to disk
   void SetWriteTree(Bool_t option=kTRUE)  {fWriteTree = option;}
   Bool_t WriteTree() const {return fWriteTree;}
+  // Basket size of the branches of the split event branch; larger baskets mean fewer reads per branch
+  void SetTreeBasketSize(Int_t size)  {fTreeBasketSize = size;}
   
   // Toggle on/off information branches
   void SetFillTrackInfo(Bool_t flag=kTRUE)        {fFillTrackInfo = flag;}
@@ -114,6 +116,7 @@ public:
   
   Int_t    fTreeWritingOption;     // one of the options described by ETreeWritingOptions
   Bool_t fWriteTree;                   // if kFALSE don't write the tree, use task only to produce on the fly reduced events
+  Int_t  fTreeBasketSize;              // basket size of the event branches
   Bool_t fWriteEventsWithNoSelectedTracks;   // write events without any selected tracks
   
   Bool_t fFillTrackInfo;             // fill track information
@@ -176,6 +179,6 @@ public:
   AliAnalysisTaskReducedTreeMaker(const AliAnalysisTaskReducedTreeMaker &c);
   AliAnalysisTaskReducedTreeMaker& operator= (const AliAnalysisTaskReducedTreeMaker &c);
 
-  ClassDef(AliAnalysisTaskReducedTreeMaker, 3); //Analysis Task for creating a reduced event information tree 
+  ClassDef(AliAnalysisTaskReducedTreeMaker, 4); //Analysis Task for creating a reduced event information tree 
 };
 #endif
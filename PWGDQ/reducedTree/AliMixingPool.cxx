@@ -0,0 +1,112 @@
+/*
+***********************************************************
+  Implementation of the AliMixingPool class
+  Compact event pool used by AliMixingHandler
+  *********************************************************
+*/
+
+#ifndef ALIMIXINGPOOL_H
+#include "AliMixingPool.h"
+#endif
+
+#include <TList.h>
+
+#include "AliReducedBaseTrack.h"
+
+ClassImp(AliMixingPool);
+
+//_________________________________________________________________________
+AliMixingPool::AliMixingPool() :
+  TObject(),
+  fNEvents(0)
+{
+  //
+  // default constructor
+  //
+  for(Int_t ileg=0; ileg<kNLegs; ++ileg) fFirst[ileg].assign(1,0);
+}
+
+
+//_________________________________________________________________________
+AliMixingPool::~AliMixingPool() {
+  //
+  // destructor
+  //
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::Clear(Option_t* /*option*/) {
+  //
+  // remove all events, the allocated memory is kept
+  //
+  fNEvents = 0;
+  for(Int_t ileg=0; ileg<kNLegs; ++ileg) {
+    fFirst[ileg].assign(1,0);
+    fMomentum[ileg].clear();
+    fCharge[ileg].clear();
+    fFlags[ileg].clear();
+  }
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::AddEvent(TList* leg1List, TList* leg2List) {
+  //
+  // add an event, copying the kinematics, charge and flags of the tracks in the leg lists
+  //
+  TList* lists[kNLegs] = {leg1List, leg2List};
+  for(Int_t ileg=0; ileg<kNLegs; ++ileg) {
+    TIter nextTrack(lists[ileg]);
+    AliReducedBaseTrack* track=0x0;
+    while((track=(AliReducedBaseTrack*)nextTrack())) {
+      fMomentum[ileg].push_back(track->Px());
+      fMomentum[ileg].push_back(track->Py());
+      fMomentum[ileg].push_back(track->Pz());
+      fMomentum[ileg].push_back(track->P());
+      fCharge[ileg].push_back(track->Charge());
+      fFlags[ileg].push_back(track->GetFlags());
+    }
+    fFirst[ileg].push_back(fFlags[ileg].size());
+  }
+  ++fNEvents;
+}
+
+
+//_________________________________________________________________________
+void AliMixingPool::UnsetFlags(ULong_t mask) {
+  //
+  // unset the flags in mask for all the tracks in the pool,
+  // then remove the tracks without any flag left and the events without any track left
+  //
+  Int_t nEvents = 0;
+  Int_t write[kNLegs] = {0,0};
+  for(Int_t iev=0; iev<fNEvents; ++iev) {
+    Int_t start[kNLegs] = {write[0], write[1]};
+    for(Int_t ileg=0; ileg<kNLegs; ++ileg) {
+      Int_t first = fFirst[ileg][iev];
+      Int_t last = fFirst[ileg][iev+1];
+      for(Int_t it=first; it<last; ++it) {
+        ULong_t flags = fFlags[ileg][it] & (~mask);
+        if(!flags) continue;
+        Int_t iw = write[ileg]++;
+        for(Int_t i=0; i<kNMomentum; ++i) fMomentum[ileg][kNMomentum*iw+i] = fMomentum[ileg][kNMomentum*it+i];
+        fCharge[ileg][iw] = fCharge[ileg][it];
+        fFlags[ileg][iw] = flags;
+      }
+    }
+    // the event is kept if one of the lists still has tracks
+    if(write[0]==start[0] && write[1]==start[1]) continue;
+    for(Int_t ileg=0; ileg<kNLegs; ++ileg) fFirst[ileg][nEvents] = start[ileg];
+    ++nEvents;
+  }
+
+  fNEvents = nEvents;
+  for(Int_t ileg=0; ileg<kNLegs; ++ileg) {
+    fFirst[ileg].resize(fNEvents+1);
+    fFirst[ileg][fNEvents] = write[ileg];
+    fMomentum[ileg].resize(kNMomentum*write[ileg]);
+    fCharge[ileg].resize(write[ileg]);
+    fFlags[ileg].resize(write[ileg]);
+  }
+}
@@ -0,0 +1,53 @@
+//
+// Compact event pool used by AliMixingHandler
+//
+// Only the leg kinematics (px,py,pz,p), the charge and the cut flags of the tracks
+// are kept, in flat arrays, instead of clones of the full track objects.
+// The tracks of event iev are stored in [GetFirst(leg,iev),GetLast(leg,iev)) for
+// each of the two leg lists.
+//
+#ifndef ALIMIXINGPOOL_H
+#define ALIMIXINGPOOL_H
+
+#include <vector>
+#include <TObject.h>
+
+class TList;
+
+class AliMixingPool : public TObject {
+
+public:
+  AliMixingPool();
+  virtual ~AliMixingPool();
+
+  enum Constants {
+    kNLegs=2,        // leg1 and leg2 lists
+    kNMomentum=4     // px, py, pz, p stored per track
+  };
+
+  void AddEvent(TList* leg1List, TList* leg2List);
+  void UnsetFlags(ULong_t mask);
+  virtual void Clear(Option_t* option="");
+
+  Int_t GetNEvents() const {return fNEvents;}
+  Int_t GetFirst(Int_t leg, Int_t iev) const {return fFirst[leg][iev];}
+  Int_t GetLast(Int_t leg, Int_t iev) const {return fFirst[leg][iev+1];}
+  Int_t GetNTracks(Int_t leg, Int_t iev) const {return fFirst[leg][iev+1]-fFirst[leg][iev];}
+  const Float_t* GetMomentum(Int_t leg, Int_t itrack) const {return &fMomentum[leg][kNMomentum*itrack];}
+  Int_t GetCharge(Int_t leg, Int_t itrack) const {return fCharge[leg][itrack];}
+  ULong_t GetFlags(Int_t leg, Int_t itrack) const {return fFlags[leg][itrack];}
+
+private:
+  AliMixingPool(const AliMixingPool& pool);
+  AliMixingPool& operator=(const AliMixingPool& pool);
+
+  Int_t fNEvents;                             // number of events in the pool
+  std::vector<Int_t>   fFirst[kNLegs];        //! index of the first track of each event, [fNEvents+1]
+  std::vector<Float_t> fMomentum[kNLegs];     //! px,py,pz,p of the tracks
+  std::vector<Char_t>  fCharge[kNLegs];       //! charge of the tracks
+  std::vector<ULong_t> fFlags[kNLegs];        //! cut flags of the tracks
+
+  ClassDef(AliMixingPool,1);
+};
+
+#endif
@@ -41,7 +41,12 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
-  fEventCounter(0)
+  fEventCounter(0),
+  fTrackCutArray(),
+  fTrackHistPrefix(""),
+  fTrackHistNames(),
+  fPairHistPrefix(""),
+  fPairHistNames()
 {
   //
   // default constructor
@@ -68,7 +73,12 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
-  fEventCounter(0)
+  fEventCounter(0),
+  fTrackCutArray(),
+  fTrackHistPrefix(""),
+  fTrackHistNames(),
+  fPairHistPrefix(""),
+  fPairHistNames()
 {
   //
   // named constructor
@@ -104,6 +114,7 @@ void AliReducedAnalysisJpsi2ee::AddTrackCut(AliReducedInfoCut* cut) {
    // Add a new cut
    //
    fTrackCuts.Add(cut); 
+   fTrackCutArray.push_back(cut);
    fMixingHandler->SetNParallelCuts(fMixingHandler->GetNParallelCuts()+1);
    TString histClassNames = fMixingHandler->GetHistClassNames();
    histClassNames += Form("PairMEPP_%s;", cut->GetName());
@@ -134,10 +145,12 @@ Bool_t AliReducedAnalysisJpsi2ee::IsTrackSelected(AliReducedBaseTrack* track, Fl
   // apply event cuts
   //
   if(fTrackCuts.GetEntries()==0) return kTRUE;
+  if((Int_t)fTrackCutArray.size()!=fTrackCuts.GetEntries()) BuildTrackCutArray();
   track->ResetFlags();
   
-  for(Int_t i=0; i<fTrackCuts.GetEntries(); ++i) {
-    AliReducedInfoCut* cut = (AliReducedInfoCut*)fTrackCuts.At(i);
+  // evaluate all the cuts in one pass over the cut array (TList::At() is linear in the cut index)
+  for(UInt_t i=0; i<fTrackCutArray.size(); ++i) {
+    AliReducedInfoCut* cut = fTrackCutArray[i];
     if(values) { if(cut->IsSelected(track, values)) track->SetFlag(i); }
     else { if(cut->IsSelected(track)) track->SetFlag(i); }
   }
@@ -198,6 +211,61 @@ void AliReducedAnalysisJpsi2ee::Init() {
    fHistosManager->SetDefaultVarNames(AliReducedVarManager::fgVariableNames,AliReducedVarManager::fgVariableUnits);
    
    fMixingHandler->SetHistogramManager(fHistosManager);
+   
+   BuildTrackCutArray();
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::BuildTrackCutArray() {
+  //
+  // cache the track cut pointers, indexed by their bit in the track flags
+  //
+   fTrackCutArray.clear();
+   TIter nextCut(&fTrackCuts);
+   AliReducedInfoCut* cut = 0x0;
+   while((cut=(AliReducedInfoCut*)nextCut())) fTrackCutArray.push_back(cut);
+   fTrackHistPrefix = ""; fTrackHistNames.clear();
+   fPairHistPrefix = ""; fPairHistNames.clear();
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::BuildTrackHistNames(const TString& trackClass) {
+  //
+  // build the track histogram class names of all the cuts for the track class trackClass,
+  // such that they are not formatted for every track and every cut
+  //
+   if((Int_t)fTrackCutArray.size()!=fTrackCuts.GetEntries()) BuildTrackCutArray();
+   const Char_t* histTypes[kNTrackHistTypes] = {"", "StatusFlags", "ITSclusterMap", "TPCclusterMap"};
+   fTrackHistPrefix = trackClass;
+   fTrackHistNames.resize(fTrackCutArray.size()*kNTrackHistTypes*2);
+   for(UInt_t icut=0; icut<fTrackCutArray.size(); ++icut) {
+      for(Int_t itype=0; itype<kNTrackHistTypes; ++itype) {
+         TString name = Form("%s%s_%s", trackClass.Data(), histTypes[itype], fTrackCutArray[icut]->GetName());
+         fTrackHistNames[(icut*kNTrackHistTypes+itype)*2] = name;
+         fTrackHistNames[(icut*kNTrackHistTypes+itype)*2+1] = name + "_MCTruth";
+      }
+   }
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::BuildPairHistNames(const TString& pairClass) {
+  //
+  // build the pair histogram class names of all the cuts and pair types for the pair class pairClass
+  //
+   if((Int_t)fTrackCutArray.size()!=fTrackCuts.GetEntries()) BuildTrackCutArray();
+   const Char_t* typeStr[3] = {"PP", "PM", "MM"};
+   fPairHistPrefix = pairClass;
+   fPairHistNames.resize(3*fTrackCutArray.size()*2);
+   for(Int_t itype=0; itype<3; ++itype) {
+      for(UInt_t icut=0; icut<fTrackCutArray.size(); ++icut) {
+         TString name = Form("%s%s_%s", pairClass.Data(), typeStr[itype], fTrackCutArray[icut]->GetName());
+         fPairHistNames[(itype*fTrackCutArray.size()+icut)*2] = name;
+         fPairHistNames[(itype*fTrackCutArray.size()+icut)*2+1] = name + "_MCTruth";
+      }
+   }
 }
 
 
@@ -324,27 +392,33 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedTrackInfo* track,
    //
    // fill track level histograms
    //
+   if(fTrackCuts.GetEntries()==0) return;
+   if(fTrackHistNames.size()!=fTrackCutArray.size()*kNTrackHistTypes*2 || fTrackHistPrefix!=trackClass || 
+      (Int_t)fTrackCutArray.size()!=fTrackCuts.GetEntries()) 
+      BuildTrackHistNames(trackClass);
    Bool_t isMCTruth = fOptionRunOverMC && IsMCTruth(track);
-   for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
-      if(track->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
-            AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sStatusFlags_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         }
-         for(Int_t iLayer=0; iLayer<6; ++iLayer) {
-            AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         }
-         for(Int_t iLayer=0; iLayer<8; ++iLayer) {
-            AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         }
-      } // end if(track->TestFlag(icut))
+   ULong_t mask = track->GetFlags();
+   // loop only up to the highest bit set in the track cut mask
+   for(Int_t icut=0; icut<(Int_t)fTrackCutArray.size() && (mask>>icut); ++icut) {
+      if(!((mask>>icut) & 1)) continue;
+      const TString* names = &fTrackHistNames[icut*kNTrackHistTypes*2];
+      fHistosManager->FillHistClass(names[2*kTrackHist].Data(), fValues);
+      if(isMCTruth) fHistosManager->FillHistClass(names[2*kTrackHist+1].Data(), fValues);
+      for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
+         AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
+         fHistosManager->FillHistClass(names[2*kTrackStatusFlagsHist].Data(), fValues);
+         if(isMCTruth) fHistosManager->FillHistClass(names[2*kTrackStatusFlagsHist+1].Data(), fValues);
+      }
+      for(Int_t iLayer=0; iLayer<6; ++iLayer) {
+         AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
+         fHistosManager->FillHistClass(names[2*kTrackITSclusterMapHist].Data(), fValues);
+         if(isMCTruth) fHistosManager->FillHistClass(names[2*kTrackITSclusterMapHist+1].Data(), fValues);
+      }
+      for(Int_t iLayer=0; iLayer<8; ++iLayer) {
+         AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
+         fHistosManager->FillHistClass(names[2*kTrackTPCclusterMapHist].Data(), fValues);
+         if(isMCTruth) fHistosManager->FillHistClass(names[2*kTrackTPCclusterMapHist+1].Data(), fValues);
+      }
    }  // end loop over cuts
 }
 
@@ -354,13 +428,15 @@ void AliReducedAnalysisJpsi2ee::FillPairHistograms(ULong_t mask, Int_t pairType,
    //
    // fill pair level histograms
    // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
-   TString typeStr[3] = {"PP", "PM", "MM"};
-   for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
-      if(mask & (ULong_t(1)<<icut)) {
-         fHistosManager->FillHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth && pairType==1) fHistosManager->FillHistClass(Form("%s%s_%s_MCTruth", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
-      }
-         
+   if(fTrackCuts.GetEntries()==0) return;
+   if(fPairHistNames.size()!=3*fTrackCutArray.size()*2 || fPairHistPrefix!=pairClass || 
+      (Int_t)fTrackCutArray.size()!=fTrackCuts.GetEntries()) 
+      BuildPairHistNames(pairClass);
+   const TString* names = &fPairHistNames[pairType*fTrackCutArray.size()*2];
+   for(Int_t icut=0; icut<(Int_t)fTrackCutArray.size() && (mask>>icut); ++icut) {
+      if(!((mask>>icut) & 1)) continue;
+      fHistosManager->FillHistClass(names[2*icut].Data(), fValues);
+      if(isMCTruth && pairType==1) fHistosManager->FillHistClass(names[2*icut+1].Data(), fValues);
    }  // end loop over cuts
 }
 
@@ -372,6 +448,9 @@ void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
    //
    // clear the track arrays
    fPosTracks.Clear("C"); fNegTracks.Clear("C"); fPrefilterPosTracks.Clear("C"); fPrefilterNegTracks.Clear("C");
+   for(Int_t ileg=0; ileg<2; ++ileg) {
+      fLegTracks[ileg].clear(); fLegFlags[ileg].clear(); fPrefilterLegTracks[ileg].clear();
+   }
    fValues[AliReducedVarManager::kEvAverageTPCchi2] = 0.0;
    
    // loop over the track list and evaluate all the track cuts
@@ -400,12 +479,12 @@ void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
       }
       if(IsTrackSelected(track, fValues)) {
          fValues[AliReducedVarManager::kEvAverageTPCchi2] += track->TPCchi2();
-         if(track->Charge()>0) fPosTracks.Add(track);
-         if(track->Charge()<0) fNegTracks.Add(track);
+         if(track->Charge()>0) {fPosTracks.Add(track); fLegTracks[0].push_back(track); fLegFlags[0].push_back(track->GetFlags());}
+         if(track->Charge()<0) {fNegTracks.Add(track); fLegTracks[1].push_back(track); fLegFlags[1].push_back(track->GetFlags());}
       }
       if(IsTrackPrefilterSelected(track, fValues)) {
-         if(track->Charge()>0) fPrefilterPosTracks.Add(track);
-         if(track->Charge()<0) fPrefilterNegTracks.Add(track);
+         if(track->Charge()>0) {fPrefilterPosTracks.Add(track); fPrefilterLegTracks[0].push_back(track);}
+         if(track->Charge()<0) {fPrefilterNegTracks.Add(track); fPrefilterLegTracks[1].push_back(track);}
       }
    }   // end loop over tracks
 }
@@ -415,41 +494,35 @@ void AliReducedAnalysisJpsi2ee::RunTrackSelection() {
 void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE"*/) {
    //
    // Run the same event pairing
+   // NOTE: the pairs are built from the selected leg table, only pairs of tracks with at least one common track cut bit are filled
    //
    fValues[AliReducedVarManager::kNpairsSelected] = 0;
    
-   TIter nextPosTrack(&fPosTracks);
-   TIter nextNegTrack(&fNegTracks);
+   const std::vector<AliReducedTrackInfo*>& posTracks = fLegTracks[0];
+   const std::vector<AliReducedTrackInfo*>& negTracks = fLegTracks[1];
+   const std::vector<ULong_t>& posFlags = fLegFlags[0];
+   const std::vector<ULong_t>& negFlags = fLegFlags[1];
    
-   AliReducedTrackInfo* pTrack=0;
-   AliReducedTrackInfo* pTrack2=0;
-   AliReducedTrackInfo* nTrack=0;
-   AliReducedTrackInfo* nTrack2=0;
-   for(Int_t ip=0; ip<fPosTracks.GetEntries(); ++ip) {
-      pTrack = (AliReducedTrackInfo*)nextPosTrack();
-      
-      nextNegTrack.Reset();
-      for(Int_t in=0; in<fNegTracks.GetEntries(); ++in) {
-         nTrack = (AliReducedTrackInfo*)nextNegTrack();
-         
+   for(UInt_t ip=0; ip<posTracks.size(); ++ip) {
+      for(UInt_t in=0; in<negTracks.size(); ++in) {
          // verify that the two current tracks have at least 1 common bit
-         if(!(pTrack->GetFlags() & nTrack->GetFlags())) continue;
-         AliReducedVarManager::FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
+         ULong_t mask = posFlags[ip] & negFlags[in];
+         if(!mask) continue;
+         AliReducedVarManager::FillPairInfo(posTracks[ip], negTracks[in], AliReducedPairInfo::kJpsiToEE, fValues);
          if(IsPairSelected(fValues)) {
-            FillPairHistograms(pTrack->GetFlags() & nTrack->GetFlags(), 1, pairClass, fOptionRunOverMC && IsMCTruth(pTrack, nTrack));    // 1 is for +- pairs 
+            FillPairHistograms(mask, 1, pairClass, fOptionRunOverMC && IsMCTruth(posTracks[ip], negTracks[in]));    // 1 is for +- pairs 
             fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
          }
       }  // end loop over negative tracks
       
       if(fOptionRunLikeSignPairing) {
-         for(Int_t ip2=ip+1; ip2<fPosTracks.GetEntries(); ++ip2) {
-            pTrack2 = (AliReducedTrackInfo*)fPosTracks.At(ip2);
-         
+         for(UInt_t ip2=ip+1; ip2<posTracks.size(); ++ip2) {
             // verify that the two current tracks have at least 1 common bit
-            if(!(pTrack->GetFlags() & pTrack2->GetFlags())) continue;
-            AliReducedVarManager::FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            ULong_t mask = posFlags[ip] & posFlags[ip2];
+            if(!mask) continue;
+            AliReducedVarManager::FillPairInfo(posTracks[ip], posTracks[ip2], AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(pTrack->GetFlags() & pTrack2->GetFlags(), 0, pairClass);       // 0 is for ++ pairs 
+               FillPairHistograms(mask, 0, pairClass);       // 0 is for ++ pairs 
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
             }
          }  // end loop over positive tracks
@@ -457,18 +530,14 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
    }  // end loop over positive tracks
    
    if(fOptionRunLikeSignPairing) {
-      nextNegTrack.Reset();
-      for(Int_t in=0; in<fNegTracks.GetEntries(); ++in) {
-         nTrack = (AliReducedTrackInfo*)nextNegTrack();
-      
-         for(Int_t in2=in+1; in2<fNegTracks.GetEntries(); ++in2) {
-            nTrack2 = (AliReducedTrackInfo*)fNegTracks.At(in2);
-         
+      for(UInt_t in=0; in<negTracks.size(); ++in) {
+         for(UInt_t in2=in+1; in2<negTracks.size(); ++in2) {
             // verify that the two current tracks have at least 1 common bit
-            if(!(nTrack->GetFlags() & nTrack2->GetFlags())) continue;
-            AliReducedVarManager::FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
+            ULong_t mask = negFlags[in] & negFlags[in2];
+            if(!mask) continue;
+            AliReducedVarManager::FillPairInfo(negTracks[in], negTracks[in2], AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(nTrack->GetFlags() & nTrack2->GetFlags(), 2, pairClass);      // 2 is for -- pairs
+               FillPairHistograms(mask, 2, pairClass);      // 2 is for -- pairs
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
             }
          }  // end loop over negative tracks
@@ -482,83 +551,50 @@ void AliReducedAnalysisJpsi2ee::RunPrefilter() {
    //
    // Run the prefilter selection
    // At this point it is assumed that the track lists are filled
+   // A selected track is removed if it makes a pair failing the prefilter pair cuts with any of the prefilter tracks
    //
-   TIter nextPosTrack(&fPosTracks);
-   TIter nextNegTrack(&fNegTracks);
-   TIter nextPosPrefilterTrack(&fPrefilterPosTracks);
-   TIter nextNegPrefilterTrack(&fPrefilterNegTracks);
+   // without prefilter pair cuts no pair can fail the prefilter
+   if(fPreFilterPairCuts.GetEntries()==0) return;
    
-   // First pair the positive trackes with the prefilter selected tracks
-   AliReducedTrackInfo* track=0;
-   AliReducedTrackInfo* trackPref=0;
-   for(Int_t ip = 0; ip<fPosTracks.GetEntries(); ++ip) {
-      track = (AliReducedTrackInfo*)nextPosTrack();
+   for(Int_t ileg=0; ileg<2; ++ileg) {
+      std::vector<AliReducedTrackInfo*>& legTracks = fLegTracks[ileg];
+      std::vector<ULong_t>& legFlags = fLegFlags[ileg];
       
-      nextPosPrefilterTrack.Reset();
-      for(Int_t ipp = 0; ipp<fPrefilterPosTracks.GetEntries(); ++ipp) {
-         trackPref = (AliReducedTrackInfo*)nextPosPrefilterTrack();
-         
-         if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
-         if(!IsPairPreFilterSelected(fValues)) {
-            track->ResetFlags(); 
-            break;
+      UInt_t nKept = 0;
+      for(UInt_t it=0; it<legTracks.size(); ++it) {
+         AliReducedTrackInfo* track = legTracks[it];
+         Bool_t rejected = kFALSE;
+         // pair with the positive, then with the negative prefilter tracks
+         for(Int_t ipref=0; ipref<2 && !rejected; ++ipref) {
+            const std::vector<AliReducedTrackInfo*>& prefTracks = fPrefilterLegTracks[ipref];
+            for(UInt_t ip=0; ip<prefTracks.size(); ++ip) {
+               if(ipref==ileg && track->TrackId()==prefTracks[ip]->TrackId()) continue;       // avoid self-pairing
+               AliReducedVarManager::FillPairInfo(track, prefTracks[ip], AliReducedPairInfo::kJpsiToEE, fValues);
+               if(!IsPairPreFilterSelected(fValues)) {
+                  rejected = kTRUE;
+                  break;
+               }
+            }  // end loop over prefilter tracks
          }
-      }  // end loop over positive prefilter tracks
-      
-      nextNegPrefilterTrack.Reset();
-      for(Int_t ipn = 0; ipn<fPrefilterNegTracks.GetEntries(); ++ipn) {
-         trackPref = (AliReducedTrackInfo*)nextNegPrefilterTrack();
-         
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
-         if(!IsPairPreFilterSelected(fValues)) {
-            track->ResetFlags(); 
-            break;
+         if(rejected) {
+            track->ResetFlags();
+            continue;
          }
-      }  // end loop over negative prefilter tracks
-   }  // end loop over the positive tracks
-
-   for(Int_t in = 0; in<fNegTracks.GetEntries(); ++in) {
-      track = (AliReducedTrackInfo*)nextNegTrack();
+         legTracks[nKept] = track;
+         legFlags[nKept] = legFlags[it];
+         ++nKept;
+      }  // end loop over the selected tracks
       
-      nextPosPrefilterTrack.Reset();
-      for(Int_t ipp = 0; ipp<fPrefilterPosTracks.GetEntries(); ++ipp) {
-         trackPref = (AliReducedTrackInfo*)nextPosPrefilterTrack();
-         
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
-         if(!IsPairPreFilterSelected(fValues)) {
-            track->ResetFlags(); 
-            break;
-         }
-      }  // end loop over positive prefilter tracks
-      
-      nextNegPrefilterTrack.Reset();
-      for(Int_t ipn = 0; ipn<fPrefilterNegTracks.GetEntries(); ++ipn) {
-         trackPref = (AliReducedTrackInfo*)nextNegPrefilterTrack();
-         
-         if(track->TrackId()==trackPref->TrackId()) continue;       // avoid self-pairing
-         AliReducedVarManager::FillPairInfo(track, trackPref, AliReducedPairInfo::kJpsiToEE, fValues);
-         if(!IsPairPreFilterSelected(fValues)) {
-            track->ResetFlags(); 
-            break;
-         }
-      }  // end loop over negative prefilter tracks
-   }  // end loop over the negative tracks
-
-   // remove tracks
-   nextPosTrack.Reset();
-   for(Int_t ip = fPosTracks.GetEntries()-1 ; ip >= 0; --ip) {
-     track = (AliReducedTrackInfo*)nextPosTrack();
-     if(!track->GetFlags()) fPosTracks.Remove(track);
+      // remove the rejected tracks, keeping the order of the selected tracks
+      if(nKept==legTracks.size()) continue;
+      legTracks.resize(nKept); legFlags.resize(nKept);
+      TList& trackList = (ileg==0 ? fPosTracks : fNegTracks);
+      trackList.Clear("C");
+      for(UInt_t it=0; it<nKept; ++it) trackList.Add(legTracks[it]);
    }
-  nextNegTrack.Reset();
-  for(Int_t ip = fNegTracks.GetEntries()-1 ; ip >= 0; --ip) {
-    track = (AliReducedTrackInfo*)nextNegTrack();
-    if(!track->GetFlags()) fNegTracks.Remove(track);
-  }
-
 }
 
+
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2ee::Finish() {
   //
@@ -5,7 +5,10 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EE_H
 #define ALIREDUCEDANALYSISJPSI2EE_H
 
+#include <vector>
+
 #include <TList.h>
+#include <TString.h>
 
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedInfoCut.h"
@@ -80,6 +83,17 @@ protected:
    
    ULong_t fEventCounter;   // event counter
    
+   // per event table of the selected legs, index 0 for positive and 1 for negative tracks
+   std::vector<AliReducedTrackInfo*> fLegTracks[2];            //! selected tracks
+   std::vector<ULong_t>              fLegFlags[2];             //! track cut masks of the selected tracks
+   std::vector<AliReducedTrackInfo*> fPrefilterLegTracks[2];   //! prefilter selected tracks
+   
+   std::vector<AliReducedInfoCut*>   fTrackCutArray;           //! track cuts in fTrackCuts, indexed by their bit in the track flags
+   TString                           fTrackHistPrefix;         //! track class the track histogram class names were built for
+   std::vector<TString>              fTrackHistNames;          //! track histogram class names, [cut][kNTrackHistTypes][MC truth]
+   TString                           fPairHistPrefix;          //! pair class the pair histogram class names were built for
+   std::vector<TString>              fPairHistNames;           //! pair histogram class names, [pair type][cut][MC truth]
+   
   Bool_t IsEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
   Bool_t IsTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
   Bool_t IsTrackPrefilterSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
@@ -97,7 +111,14 @@ protected:
   void FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass = "PairSE", Bool_t isMCTruth = kFALSE);
   void FillMCTruthHistograms();
   
-  ClassDef(AliReducedAnalysisJpsi2ee,3);
+  enum TrackHistTypes {
+     kTrackHist=0, kTrackStatusFlagsHist, kTrackITSclusterMapHist, kTrackTPCclusterMapHist, kNTrackHistTypes
+  };
+  void BuildTrackCutArray();
+  void BuildTrackHistNames(const TString& trackClass);
+  void BuildPairHistNames(const TString& pairClass);
+  
+  ClassDef(AliReducedAnalysisJpsi2ee,4);
 };
 
 #endif
@@ -5,6 +5,7 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjArray.h>
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
@@ -15,6 +16,13 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
+    fReadTracks(kTRUE),
+    fReadPairs(kTRUE),
+    fReadCaloClusters(kTRUE),
+    fReadFMD(kTRUE),
+    fReadEventPlane(kTRUE),
+    fReadTrackFields(""),
+    fReadPairFields(""),
     fReducedEvent(0)
 {
   // Default constructor
@@ -24,6 +32,13 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
+  fReadTracks(kTRUE),
+  fReadPairs(kTRUE),
+  fReadCaloClusters(kTRUE),
+  fReadFMD(kTRUE),
+  fReadEventPlane(kTRUE),
+  fReadTrackFields(""),
+  fReadPairFields(""),
   fReducedEvent(0)
  {
     // Constructor
@@ -46,6 +61,14 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
     SwitchOffBranches();
     SwitchOnBranches();
     
+    // the event branch is fully split, so that each data member of the tracks, pairs, clusters etc.
+    // is stored in its own branch and only the requested ones need to be read
+    SetCollectionBranchStatus("fTracks", fReadTracks, fReadTrackFields);
+    SetCollectionBranchStatus("fCandidates", fReadPairs, fReadPairFields);
+    SetCollectionBranchStatus("fCaloClusters", fReadCaloClusters, "");
+    SetCollectionBranchStatus("fFMD", fReadFMD, "");
+    SetCollectionBranchStatus("fEventPlane", fReadEventPlane, "");
+    
     // Get pointer to the event
     if (!fReducedEvent) {
        switch(fEventInputOption) {
@@ -63,6 +86,25 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 }
 
 
+//______________________________________________________________________________
+void AliReducedEventInputHandler::SetCollectionBranchStatus(const Char_t* collection, Bool_t read, const TString& fields)
+{
+    // Switch off the branches of a collection of the event, or all its data members except for the listed fields
+    if (!fTree->FindBranch(collection)) return;       // collection not present in this type of event
+    if (!read) {
+       fTree->SetBranchStatus(Form("%s*", collection), 0);
+       return;
+    }
+    if (fields.IsNull()) return;
+    
+    fTree->SetBranchStatus(Form("%s.*", collection), 0);
+    TObjArray* arfields = fields.Tokenize(";");
+    for (Int_t i=0; i<arfields->GetEntries(); ++i)
+       fTree->SetBranchStatus(Form("%s.%s*", collection, arfields->At(i)->GetName()), 1);
+    delete arfields;
+}
+
+
 //______________________________________________________________________________
 Bool_t AliReducedEventInputHandler::BeginEvent(Long64_t entry)
 {
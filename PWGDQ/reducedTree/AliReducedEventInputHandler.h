@@ -6,6 +6,8 @@
 //     Author: Ionut-Cristian Arsene, iarsene@cern.ch, i.c.arsene@fys.uio.no
 //
 
+#include <TString.h>
+
 #include "AliInputEventHandler.h"
 #include "AliReducedBaseEvent.h"
 //#include "AliReducedEventInfo.h"
@@ -34,15 +36,35 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
                  
+                 // Selective reading of the split event branch: collections which are switched off are not read at all,
+                 // and if a list of fields is given for the tracks or pairs, only these data members are read (e.g. "fP;fQualityFlags;fStatus")
+                 // NOTE: data members which are not read keep undefined values in the track/pair objects
+                 void                                SetReadTracks(Bool_t flag=kTRUE) {fReadTracks = flag;}
+                 void                                SetReadPairs(Bool_t flag=kTRUE) {fReadPairs = flag;}
+                 void                                SetReadCaloClusters(Bool_t flag=kTRUE) {fReadCaloClusters = flag;}
+                 void                                SetReadFMD(Bool_t flag=kTRUE) {fReadFMD = flag;}
+                 void                                SetReadEventPlane(Bool_t flag=kTRUE) {fReadEventPlane = flag;}
+                 void                                AddReadTrackField(TString field) {fReadTrackFields += field+";";}
+                 void                                AddReadPairField(TString field) {fReadPairFields += field+";";}
+                 
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
+    void   SetCollectionBranchStatus(const Char_t* collection, Bool_t read, const TString& fields);
+    
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
+    Bool_t fReadTracks;                                // if false, the track branches are not read
+    Bool_t fReadPairs;                                 // if false, the pair candidate branches are not read
+    Bool_t fReadCaloClusters;                          // if false, the calorimeter cluster branches are not read
+    Bool_t fReadFMD;                                   // if false, the FMD branches are not read
+    Bool_t fReadEventPlane;                            // if false, the event plane branches are not read
+    TString fReadTrackFields;                          // list of track data members to be read, all if empty
+    TString fReadPairFields;                           // list of pair data members to be read, all if empty
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -1580,13 +1580,25 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  Float_t p1[4] = {t1->Px(), t1->Py(), t1->Pz(), t1->P()};
+  Float_t p2[4] = {t2->Px(), t2->Py(), t2->Pz(), t2->P()};
+  FillPairInfoME(p1, t1->Charge(), p2, t2->Charge(), type, values);
+}
+
+
+//_________________________________________________________________
+void AliReducedVarManager::FillPairInfoME(const Float_t* p1, Int_t q1, const Float_t* p2, Int_t q2, Int_t type, Float_t* values) {
+  //
+  // Fill pair information from the leg kinematics, p1 and p2 = (px,py,pz,p), and charges
+  // NOTE: Used by the event mixing with the compact pools of AliMixingPool
+  //
   PAIR p;
-  p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
+  p.PxPyPz(p1[0]+p2[0], p1[1]+p2[1], p1[2]+p2[2]);
   p.CandidateId(type);
     
-  if(t1->Charge()*t2->Charge()<0) p.PairType(1);
-  else if(t1->Charge()>0)         p.PairType(0);
-  else                            p.PairType(2);
+  if(q1*q2<0)   p.PairType(1);
+  else if(q1>0) p.PairType(0);
+  else          p.PairType(2);
   values[kPairType] = p.PairType();
   values[kCandidateId] = type;
   values[kPairChisquare] = -999.;
@@ -1596,14 +1608,14 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
     
   if(fgUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
-                    2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
-                    t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
+                    2.0*(TMath::Sqrt(m1*m1+p1[3]*p1[3])*TMath::Sqrt(m2*m2+p2[3]*p2[3]) - 
+                    p1[0]*p2[0] - p1[1]*p2[1] - p1[2]*p2[2]);
     if(values[kMass]<0.0) {
       cout << "FillPairInfoME(track, track, type, values): Warning: Very small squared mass found. "
            << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
       cout << "   mass2: " << values[kMass] << endl;
-      cout << "p1(p,x,y,z): " << t1->P() << ", " << t1->Px() << ", " << t1->Py() << ", " << t1->Pz() << endl;
-      cout << "p2(p,x,y,z): " << t2->P() << ", " << t2->Px() << ", " << t2->Py() << ", " << t2->Pz() << endl;
+      cout << "p1(p,x,y,z): " << p1[3] << ", " << p1[0] << ", " << p1[1] << ", " << p1[2] << endl;
+      cout << "p2(p,x,y,z): " << p2[3] << ", " << p2[0] << ", " << p2[1] << ", " << p2[2] << endl;
       values[kMass] = 0.0;
     }
     else
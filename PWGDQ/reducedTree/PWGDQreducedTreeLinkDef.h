@@ -10,6 +10,7 @@
 #pragma link C++ class AliAnalysisTaskReducedTreeMaker+;
 #pragma link C++ class AliHistogramManager+;
 #pragma link C++ class AliMixingHandler+;
+#pragma link C++ class AliMixingPool+;
 #pragma link C++ class AliReducedAnalysisJpsi2ee+;
 #pragma link C++ class AliReducedAnalysisJpsi2eeMult+;
 #pragma link C++ class AliReducedAnalysisTaskSE+;
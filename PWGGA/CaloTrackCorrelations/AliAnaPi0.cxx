@@ -26,6 +26,7 @@
 
 //---- AliRoot system ----
 #include "AliAnaPi0.h"
+#include "AliAnaPi0MixedEventPool.h"
 #include "AliCaloTrackReader.h"
 #include "AliCaloPID.h"
 #include "AliMCEvent.h"
@@ -51,7 +52,7 @@ ClassImp(AliAnaPi0) ;
 /// Default Constructor. Initialized parameters with default values.
 //______________________________________________________
 AliAnaPi0::AliAnaPi0() : AliAnaCaloTrackCorrBaseClass(),
-fEventsList(0x0),
+fEventsPool(0x0),
 fUseAngleCut(kFALSE),        fUseAngleEDepCut(kFALSE),     fAngleCut(0),                 fAngleMaxCut(0.),
 fMultiCutAna(kFALSE),        fMultiCutAnaSim(kFALSE),      fMultiCutAnaAcc(kFALSE),
 fNPtCuts(0),                 fNAsymCuts(0),                fNCellNCuts(0),               fNPIDBits(0), fNAngleCutBins(0),
@@ -226,7 +227,7 @@ AliAnaPi0::~AliAnaPi0()
 {
   // Remove event containers
   
-  if(DoOwnMix() && fEventsList)
+  if(fEventsPool)
   {
     for(Int_t ic=0; ic<GetNCentrBin(); ic++)
     {
@@ -235,12 +236,11 @@ AliAnaPi0::~AliAnaPi0()
         for(Int_t irp=0; irp<GetNRPBin(); irp++)
         {
           Int_t bin = GetEventMixBin(ic,iz,irp);
-          fEventsList[bin]->Delete() ;
-          delete fEventsList[bin] ;
+          delete fEventsPool[bin] ;
         }
       }
     }
-    delete[] fEventsList;
+    delete[] fEventsPool;
   }
 }
 
@@ -798,7 +798,8 @@ TList * AliAnaPi0::GetCreateOutputObjects()
   //
   // Create mixed event containers
   //
-  fEventsList = new TList*[GetNCentrBin()*GetNZvertBin()*GetNRPBin()] ;
+  // Keep at most GetNMaxEvMix()-1 previous events per bin, as done with the former TList buffers
+  fEventsPool = new AliAnaPi0MixedEventPool*[GetNCentrBin()*GetNZvertBin()*GetNRPBin()] ;
   
   for(Int_t ic=0; ic<GetNCentrBin(); ic++)
   {
@@ -807,8 +808,7 @@ TList * AliAnaPi0::GetCreateOutputObjects()
       for(Int_t irp=0; irp<GetNRPBin(); irp++)
       {
         Int_t bin = GetEventMixBin(ic,iz,irp);
-        fEventsList[bin] = new TList() ;
-        fEventsList[bin]->SetOwner(kFALSE);
+        fEventsPool[bin] = new AliAnaPi0MixedEventPool(GetNMaxEvMix()-1) ;
       }
     }
   }
@@ -4222,62 +4222,65 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
     // Check that the bin exists, if not (bad determination of RP, centrality or vz bin) do nothing
     if(eventbin < 0) return ;
     
-    TList * evMixList=fEventsList[eventbin] ;
+    AliAnaPi0MixedEventPool * evMixPool = fEventsPool[eventbin] ;
     
-    if(!evMixList)
+    if(!evMixPool)
     {
-      AliWarning(Form("Mix event list not available, bin %d",eventbin));
+      AliWarning(Form("Mix event pool not available, bin %d",eventbin));
       return;
     }
     
-    Int_t nMixed = evMixList->GetSize() ;
+    Int_t nMixed = evMixPool->GetNEvents() ;
     for(Int_t ii=0; ii<nMixed; ii++)
     {
-      TClonesArray* ev2= (TClonesArray*) (evMixList->At(ii));
-      Int_t nPhot2=ev2->GetEntriesFast() ;
-      Double_t m = -999;
-      AliDebug(1,Form("Mixed event %d photon entries %d, centrality bin %d",ii, nPhot2, GetEventCentralityBin()));
+      AliDebug(1,Form("Mixed event %d photon entries %d, centrality bin %d",ii, evMixPool->GetNClusters(ii), GetEventCentralityBin()));
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
+    }
+    
+    //---------------------------------
+    // First loop on photons/clusters
+    //---------------------------------
+    for(Int_t i1 = 0; nMixed > 0 && i1 < nPhot; i1++)
+    {
+      AliAODPWG4Particle * p1 = (AliAODPWG4Particle*) (GetInputAODBranch()->At(i1)) ;
       
-      //---------------------------------
-      // First loop on photons/clusters
-      //---------------------------------
-      for(Int_t i1 = 0; i1 < nPhot; i1++)
+      // Select photons within a pT range
+      if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
+      
+      // Not sure why this line is here
+      //if(fSameSM && GetModuleNumber(p1)!=module1) continue;
+      
+      //Get kinematics of cluster and (super) module of this cluster
+      fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
+      module1 = GetModuleNumber(p1);
+      
+      Int_t ncell1 = p1->GetNCells();
+      
+      // Pair mass, pT, asymmetry and opening angle with all the clusters in the pool
+      evMixPool->ComputePairs(p1->Px(),p1->Py(),p1->Pz(),p1->E());
+      
+      for(Int_t ii=0; ii<nMixed; ii++)
       {
-        AliAODPWG4Particle * p1 = (AliAODPWG4Particle*) (GetInputAODBranch()->At(i1)) ;
-        
-        // Select photons within a pT range
-        if ( p1->Pt() < GetMinPt() || p1->Pt()  > GetMaxPt() ) continue ;
-        
-        // Not sure why this line is here
-        //if(fSameSM && GetModuleNumber(p1)!=module1) continue;
-        
-        //Get kinematics of cluster and (super) module of this cluster
-        fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
-        module1 = GetModuleNumber(p1);
+        Int_t nPhot2 = evMixPool->GetNClusters(ii) ;
         
         //---------------------------------
         // Second loop on other mixed event photons/clusters
         //---------------------------------
         for(Int_t i2 = 0; i2 < nPhot2; i2++)
         {
-          AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (ev2->At(i2)) ;
-          
-          // Select photons within a pT range
-          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+          // Pool index of the second cluster, only clusters in the pT range are stored
+          Int_t k2 = evMixPool->GetIndex(ii, i2);
           
-          // Get kinematics of second cluster and calculate those of the pair
-          fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
-          m           = (fPhotonMom1+fPhotonMom2).M() ;
-          Double_t pt = (fPhotonMom1 + fPhotonMom2).Pt();
-          Double_t a  = TMath::Abs(p1->E()-p2->E())/(p1->E()+p2->E()) ;
+          Double_t m     = evMixPool->GetPairMass (k2);
+          Double_t pt    = evMixPool->GetPairPt   (k2);
+          Double_t a     = evMixPool->GetPairAsym (k2);
+          Double_t angle = evMixPool->GetPairAngle(k2);
           
           // Check if opening angle is too large or too small compared to what is expected
-          Double_t angle   = fPhotonMom1.Angle(fPhotonMom2.Vect());
-          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow((fPhotonMom1+fPhotonMom2).E(),angle+0.05))
+          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow(evMixPool->GetPairE(k2),angle+0.05))
           {
-            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), (fPhotonMom1+fPhotonMom2).E()));
+            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), evMixPool->GetPairE(k2)));
             continue;
           }
           
@@ -4287,10 +4290,14 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             continue;
           }
           
-          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
+          // Kinematics of second cluster
+          fPhotonMom2.SetPxPyPzE(evMixPool->GetPx(k2),evMixPool->GetPy(k2),evMixPool->GetPz(k2),evMixPool->GetE(k2));
+          Float_t pt2 = evMixPool->GetPt(k2);
+          
+          AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), pt2, pt,m,a));
           
           // In case we want only pairs in same (super) module, check their origin.
-          module2 = GetModuleNumber(p2);
+          module2 = evMixPool->GetModule(k2);
                     
           //-------------------------------------------------------------------------------------------------
           // Fill module dependent histograms, put a cut on assymmetry on the first available cut in the array
@@ -4350,7 +4357,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               Float_t phi2 = GetPhi(fPhotonMom2.Phi());
               Bool_t etaside = 0;
               if(   (p1->GetDetectorTag()==kEMCAL && fPhotonMom1.Eta() < 0) 
-                 || (p2->GetDetectorTag()==kEMCAL && fPhotonMom2.Eta() < 0)) etaside = 1;
+                 || (evMixPool->GetDetectorTag(k2)==kEMCAL && fPhotonMom2.Eta() < 0)) etaside = 1;
               
               if      (    phi1 > DegToRad(260) && phi2 > DegToRad(260) && phi1 < DegToRad(280) && phi2 < DegToRad(280))  fhMiSameSectorDCALPHOSMod[0+etaside]->Fill(pt, m, GetEventWeight());
               else if (    phi1 > DegToRad(280) && phi2 > DegToRad(280) && phi1 < DegToRad(300) && phi2 < DegToRad(300))  fhMiSameSectorDCALPHOSMod[2+etaside]->Fill(pt, m, GetEventWeight());
@@ -4392,8 +4399,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check if one of the clusters comes from a conversion
           if(fCheckConversion)
           {
-            if     (p1->IsTagged() && p2->IsTagged()) fhMiConv2->Fill(pt, m, GetEventWeight());
-            else if(p1->IsTagged() || p2->IsTagged()) fhMiConv ->Fill(pt, m, GetEventWeight());
+            if     (p1->IsTagged() && evMixPool->IsTagged(k2)) fhMiConv2->Fill(pt, m, GetEventWeight());
+            else if(p1->IsTagged() || evMixPool->IsTagged(k2)) fhMiConv ->Fill(pt, m, GetEventWeight());
           }
           
           //
@@ -4402,7 +4409,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           //
           for(Int_t ipid=0; ipid<fNPIDBits; ipid++)
           {
-            if((p1->IsPIDOK(ipid,AliCaloPID::kPhoton)) && (p2->IsPIDOK(ipid,AliCaloPID::kPhoton)))
+            if((p1->IsPIDOK(ipid,AliCaloPID::kPhoton)) && (evMixPool->IsPIDOK(k2,ipid)))
             {
               for(Int_t iasym=0; iasym < fNAsymCuts; iasym++)
               {
@@ -4417,12 +4424,12 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                   
                   if(fFillBadDistHisto)
                   {
-                    if(p1->DistToBad()>0 && p2->DistToBad()>0)
+                    if(p1->DistToBad()>0 && evMixPool->GetDistToBad(k2)>0)
                     {
                       fhMi2[index]->Fill(pt, m, GetEventWeight()) ;
                       if(fMakeInvPtPlots)fhMiInvPt2[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
                       
-                      if(p1->DistToBad()>1 && p2->DistToBad()>1)
+                      if(p1->DistToBad()>1 && evMixPool->GetDistToBad(k2)>1)
                       {
                         fhMi3[index]->Fill(pt, m, GetEventWeight()) ;
                         if(fMakeInvPtPlots)fhMiInvPt3[index]->Fill(pt, m, 1./pt * GetEventWeight()) ;
@@ -4438,8 +4445,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           //-----------------------
           // Multi cuts analysis
           //-----------------------
-          Int_t  ncell1 = p1->GetNCells();
-          Int_t  ncell2 = p1->GetNCells();
+          Int_t  ncell2 = evMixPool->GetNCells(k2);
           
           if(fMultiCutAna)
           {
@@ -4452,8 +4458,8 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                 {
                   Int_t index = ((ipt*fNCellNCuts)+icell)*fNAsymCuts + iasym;
                   
-                  if(p1->Pt() >   fPtCuts[ipt]      && p2->Pt() > fPtCuts[ipt]      &&
-                     p1->Pt() <   fPtCutsMax[ipt]   && p2->Pt() < fPtCutsMax[ipt]   &&
+                  if(p1->Pt() >   fPtCuts[ipt]      && pt2      > fPtCuts[ipt]      &&
+                     p1->Pt() <   fPtCutsMax[ipt]   && pt2      < fPtCutsMax[ipt]   &&
                      a        <   fAsymCuts[iasym]                                  &&
                      ncell1   >=  fCellNCuts[icell] && ncell2   >= fCellNCuts[icell] 
                      )
@@ -4496,7 +4502,7 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               Float_t e2   = fPhotonMom2.E();
               
               Float_t t1   = p1->GetTime();
-              Float_t t2   = p2->GetTime();
+              Float_t t2   = evMixPool->GetTime(k2);
               
               Int_t nc1    = ncell1;
               Int_t nc2    = ncell2;
@@ -4510,21 +4516,12 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               Int_t   mod1 = module1;
               Int_t   mod2 = module2;
               
-              //              // Recover original cluster
-              //              Int_t iclus1 = -1, iclus2 = -1 ;
-              //              AliVCluster * cluster1 = FindCluster(GetEMCALClusters(),p1->GetCaloLabel(0),iclus1);
-              //              AliVCluster * cluster2 = FindCluster(GetEMCALClusters(),p2->GetCaloLabel(0),iclus2);
-              //              
-              //              Float_t maxCellFraction1 = 0, maxCellFraction2 = 0;
-              //              Int_t absIdMax1 = GetCaloUtils()->GetMaxEnergyCell(GetEMCALCells(),cluster1,maxCellFraction1);
-              //              Int_t absIdMax2 = GetCaloUtils()->GetMaxEnergyCell(GetEMCALCells(),cluster2,maxCellFraction2);
-              
               if(e2 > e1)
               {
                 e1   = fPhotonMom2.E();
                 e2   = fPhotonMom1.E();
                 
-                t1   = p2->GetTime();
+                t1   = evMixPool->GetTime(k2);
                 t2   = p1->GetTime();
                 
                 nc1  = ncell2;
@@ -4538,10 +4535,6 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
                 
                 mod1 = module2;
                 mod2 = module1;
-                
-                //                Int_t tmp = absIdMax2;
-                //                absIdMax2 = absIdMax1;
-                //                absIdMax1 = tmp;
               }
               
               fhMiOpAngleBinMinClusterEPerSM[angleBin]->Fill(e2,mod2,GetEventWeight()) ; 
@@ -4560,17 +4553,6 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
               
               fhMiOpAngleBinMinClusterEtaPhi[angleBin]->Fill(eta2,phi2,GetEventWeight()) ;
               fhMiOpAngleBinMaxClusterEtaPhi[angleBin]->Fill(eta1,phi1,GetEventWeight()) ;
-              
-              //              Int_t   icol1 = -1, icol2 = -1, icolAbs1 = -1, icolAbs2 = -1;
-              //              Int_t   irow1 = -1, irow2 = -1, irowAbs1 = -1, irowAbs2 = -1;
-              //              Int_t   iRCU1 = -1, iRCU2 = -1;
-              //              GetModuleNumberCellIndexesAbsCaloMap(absIdMax1,GetCalorimeter(), icol1, irow1, iRCU1, icolAbs1, irowAbs1);
-              //              GetModuleNumberCellIndexesAbsCaloMap(absIdMax2,GetCalorimeter(), icol2, irow2, iRCU1, icolAbs2, irowAbs2);
-              //              
-              //              fhMiOpAngleBinPairClusterAbsIdMaxCell[angleBin]->Fill(absIdMax1,absIdMax2,GetEventWeight());
-              //
-              //              fhMiColRowClusterMinOpAngleBin[angleBin]->Fill(icolAbs2,irowAbs2,GetEventWeight()) ;
-              //              fhMiOpAngleBinMaxClusterColRow[angleBin]->Fill(icolAbs1,irowAbs1,GetEventWeight()) ;
             }
           }
           
@@ -4585,41 +4567,43 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
           // Check cell time content in cluster
           if ( fFillSecondaryCellTiming )
           {
-            if      ( p1->GetFiducialArea() == 0 && p2->GetFiducialArea() == 0 )
+            if      ( p1->GetFiducialArea() == 0 && !evMixPool->IsOutTimeWindow(k2) )
               fhMiSecondaryCellInTimeWindow ->Fill(pt, m, GetEventWeight());
             
-            else if ( p1->GetFiducialArea() != 0 && p2->GetFiducialArea() != 0 )
+            else if ( p1->GetFiducialArea() != 0 &&  evMixPool->IsOutTimeWindow(k2) )
               fhMiSecondaryCellOutTimeWindow->Fill(pt, m, GetEventWeight());
           }
                   
         }// second cluster loop
-      }//first cluster loop
-    }//loop on mixed events
+      }//loop on mixed events
+    }//first cluster loop
     
     //--------------------------------------------------------
-    // Add the current event to the list of events for mixing
+    // Add the current event to the pool of events for mixing
     //--------------------------------------------------------
     
-    //TClonesArray *currentEvent = new TClonesArray(*GetInputAODBranch());
-    TClonesArray *currentEvent = new TClonesArray(*secondLoopInputData);
+    // Only the clusters in the pT range are used in the mixing, keep just those.
+    // The oldest event is replaced if the pool is full. Events with clusters
+    // are stored even if none is in the pT range, events without clusters are not.
+    evMixPool->StartEvent();
     
-    // Add current event to buffer and Remove redundant events
-    if( currentEvent->GetEntriesFast() > 0 )
+    Int_t nPhotMix = secondLoopInputData->GetEntriesFast() ;
+    for(Int_t i2 = 0; i2 < nPhotMix; i2++)
     {
-      evMixList->AddFirst(currentEvent) ;
-      currentEvent=0 ; //Now list of particles belongs to buffer and it will be deleted with buffer
-      if( evMixList->GetSize() >= GetNMaxEvMix() )
+      AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (secondLoopInputData->At(i2)) ;
+      
+      if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+      
+      UShort_t pidMask = 0;
+      for(Int_t ipid=0; ipid<fNPIDBits; ipid++)
       {
-        TClonesArray * tmp = (TClonesArray*) (evMixList->Last()) ;
-        evMixList->RemoveLast() ;
-        delete tmp ;
+        if(p2->IsPIDOK(ipid,AliCaloPID::kPhoton)) pidMask |= (1 << ipid);
       }
+      
+      evMixPool->AddCluster(p2, GetModuleNumber(p2), pidMask);
     }
-    else
-    { // empty event
-      delete currentEvent ;
-      currentEvent=0 ;
-    }
+    
+    evMixPool->EndEvent(nPhotMix > 0);
   }// DoOwnMix
   
   AliDebug(1,"End fill histograms");
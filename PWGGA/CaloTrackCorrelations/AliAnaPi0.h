@@ -35,6 +35,7 @@ class TObjString;
 class AliAODEvent ;
 class AliESDEvent ;
 class AliAODPWG4Particle ;
+class AliAnaPi0MixedEventPool ;
 
 class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   
@@ -182,8 +183,8 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
 
   private:
 
-  /// Containers for photons in stored events
-  TList ** fEventsList ;               //![GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
+  /// Compact containers for photons in stored events, one per mixing bin
+  AliAnaPi0MixedEventPool ** fEventsPool ; //![GetNCentrBin()*GetNZvertBin()*GetNRPBin()]
   
   Bool_t   fUseAngleCut ;              ///<  Select pairs depending on their opening angle
   Bool_t   fUseAngleEDepCut ;          ///<  Select pairs depending on their opening angle
@@ -596,7 +597,7 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   AliAnaPi0 & operator = (const AliAnaPi0 & api0) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaPi0,35) ;
+  ClassDef(AliAnaPi0,36) ;
   /// \endcond
   
 } ;
@@ -0,0 +1,257 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include "TMath.h"
+
+//---- AliRoot system ----
+#include "AliAnaPi0MixedEventPool.h"
+#include "AliAODPWG4Particle.h"
+
+/// \cond CLASSIMP
+ClassImp(AliAnaPi0MixedEventPool) ;
+/// \endcond
+
+//______________________________________________________
+/// Default Constructor, no event can be stored until SetDepth() is called.
+//______________________________________________________
+AliAnaPi0MixedEventPool::AliAnaPi0MixedEventPool() : TObject(),
+fDepth(0),     fNEvents(0),   fHead(0),      fCapacity(0),  fPending(0),
+fNClusters(),
+fPx(),         fPy(),         fPz(),         fE(),          fP2(),
+fPt(),         fTime(),       fModule(),     fNCells(),     fPIDMask(),
+fDistToBad(),  fDetector(),   fFlags(),
+fPairMass(),   fPairPt(),     fPairE(),      fPairAsym(),   fPairAngle()
+{
+}
+
+//______________________________________________________
+/// Constructor.
+/// \param depth: maximum number of events kept in the pool.
+//______________________________________________________
+AliAnaPi0MixedEventPool::AliAnaPi0MixedEventPool(Int_t depth) : TObject(),
+fDepth(0),     fNEvents(0),   fHead(0),      fCapacity(0),  fPending(0),
+fNClusters(),
+fPx(),         fPy(),         fPz(),         fE(),          fP2(),
+fPt(),         fTime(),       fModule(),     fNCells(),     fPIDMask(),
+fDistToBad(),  fDetector(),   fFlags(),
+fPairMass(),   fPairPt(),     fPairE(),      fPairAsym(),   fPairAngle()
+{
+  SetDepth(depth);
+}
+
+//______________________________________________________
+/// Set the maximum number of stored events.
+/// The pool is emptied.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::SetDepth(Int_t depth)
+{
+  if ( depth < 0 ) depth = 0;
+
+  fDepth = depth;
+  fNClusters.assign(fDepth, 0);
+
+  Int_t capacity = fCapacity;
+  fCapacity = 0;
+  Resize(capacity);
+
+  Reset();
+}
+
+//______________________________________________________
+/// Remove all the stored events, memory is kept.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::Reset()
+{
+  fNEvents = 0;
+  fHead    = 0;
+  fPending = 0;
+  fNClusters.assign(fDepth, 0);
+}
+
+//______________________________________________________
+/// Enlarge the number of clusters that can be kept per event slot,
+/// stored clusters are moved to their new position.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::Resize(Int_t capacity)
+{
+  if ( capacity <= fCapacity ) return;
+
+  Int_t oldCapacity = fCapacity;
+  Int_t size        = fDepth*capacity;
+
+  fPx       .resize(size); fPy    .resize(size); fPz     .resize(size);
+  fE        .resize(size); fP2    .resize(size); fPt     .resize(size);
+  fTime     .resize(size); fModule.resize(size); fNCells .resize(size);
+  fPIDMask  .resize(size); fDetector.resize(size); fFlags.resize(size);
+  fDistToBad.resize(size);
+
+  fPairMass .resize(size); fPairPt.resize(size); fPairE  .resize(size);
+  fPairAsym .resize(size); fPairAngle.resize(size);
+
+  // Move slots from the last one, so that no slot is overwritten before being moved
+  if ( oldCapacity > 0 )
+  {
+    for(Int_t islot = fDepth-1; islot > 0; islot--)
+    {
+      Int_t from = islot*oldCapacity;
+      Int_t to   = islot*capacity;
+
+      for(Int_t i = oldCapacity-1; i >= 0; i--)
+      {
+        fPx      [to+i] = fPx      [from+i];
+        fPy      [to+i] = fPy      [from+i];
+        fPz      [to+i] = fPz      [from+i];
+        fE       [to+i] = fE       [from+i];
+        fP2      [to+i] = fP2      [from+i];
+        fPt      [to+i] = fPt      [from+i];
+        fTime    [to+i] = fTime    [from+i];
+        fModule  [to+i] = fModule  [from+i];
+        fNCells  [to+i] = fNCells  [from+i];
+        fPIDMask [to+i] = fPIDMask [from+i];
+        fDistToBad[to+i]= fDistToBad[from+i];
+        fDetector[to+i] = fDetector[from+i];
+        fFlags   [to+i] = fFlags   [from+i];
+      }
+    }
+  }
+
+  fCapacity = capacity;
+}
+
+//______________________________________________________
+/// Start storing a new event, to be called before AddCluster().
+/// The clusters are written in the slot of the oldest event,
+/// which is only replaced when EndEvent() stores the event.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::StartEvent()
+{
+  fPending = 0;
+}
+
+//______________________________________________________
+/// Store a cluster of the current event.
+/// \param part: cluster/photon to store.
+/// \param module: (super)module number of the cluster.
+/// \param pidMask: bit i set if the cluster passes the photon PID bit i.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::AddCluster(AliAODPWG4Particle * part, Int_t module, UShort_t pidMask)
+{
+  if ( fDepth <= 0 ) return;
+
+  if ( fPending >= fCapacity ) Resize(fCapacity > 0 ? 2*fCapacity : 16);
+
+  Int_t k = ((fHead+1) % fDepth)*fCapacity + fPending;
+
+  fPx      [k] = part->Px();
+  fPy      [k] = part->Py();
+  fPz      [k] = part->Pz();
+  fE       [k] = part->E();
+  fP2      [k] = fPx[k]*fPx[k] + fPy[k]*fPy[k] + fPz[k]*fPz[k];
+  fPt      [k] = part->Pt();
+  fTime    [k] = part->GetTime();
+  fModule  [k] = module;
+  fNCells  [k] = part->GetNCells();
+  fPIDMask [k] = pidMask;
+  fDistToBad[k]= part->DistToBad();
+  fDetector[k] = part->GetDetectorTag();
+
+  fFlags   [k] = 0;
+  if ( part->IsTagged()              ) fFlags[k] |= kTagged;
+  if ( part->GetFiducialArea() != 0  ) fFlags[k] |= kOutTimeWindow;
+
+  fPending++;
+}
+
+//______________________________________________________
+/// Finish storing the current event.
+/// Events without clusters are only kept if keepEmpty is set,
+/// the oldest event is replaced when the pool is full.
+/// \param keepEmpty: store the event even if no cluster was added.
+/// \return kTRUE if the event was stored.
+//______________________________________________________
+Bool_t AliAnaPi0MixedEventPool::EndEvent(Bool_t keepEmpty)
+{
+  if ( fDepth <= 0 || (fPending <= 0 && !keepEmpty) ) return kFALSE;
+
+  fHead = (fHead+1) % fDepth;
+  fNClusters[fHead] = fPending;
+  fPending = 0;
+
+  if ( fNEvents < fDepth ) fNEvents++;
+
+  return kTRUE;
+}
+
+//______________________________________________________
+/// Calculate the kinematics of the pairs formed by the given cluster
+/// and each of the clusters of all the events stored in the pool.
+/// Same definitions as TLorentzVector::M(), Pt(), E() of the pair sum
+/// and TVector3::Angle() between the two clusters.
+/// Results accessible via GetPair*(k), k being the pool index of the stored cluster.
+/// \param px: x momentum of the cluster.
+/// \param py: y momentum of the cluster.
+/// \param pz: z momentum of the cluster.
+/// \param e: energy of the cluster.
+//______________________________________________________
+void AliAnaPi0MixedEventPool::ComputePairs(Double_t px, Double_t py, Double_t pz, Double_t e)
+{
+  // the arrays are not allocated while only events without clusters were stored
+  if ( fNEvents <= 0 || fCapacity <= 0 ) return;
+
+  Double_t p2 = px*px + py*py + pz*pz;
+
+  const Double_t * px2   = &fPx[0];
+  const Double_t * py2   = &fPy[0];
+  const Double_t * pz2   = &fPz[0];
+  const Double_t * e2    = &fE [0];
+  const Double_t * p22   = &fP2[0];
+
+  Double_t * mass  = &fPairMass [0];
+  Double_t * pt    = &fPairPt   [0];
+  Double_t * esum  = &fPairE    [0];
+  Double_t * asym  = &fPairAsym [0];
+  Double_t * angle = &fPairAngle[0];
+
+  for(Int_t iev = 0; iev < fNEvents; iev++)
+  {
+    Int_t first = GetIndex(iev, 0);
+    Int_t last  = first + GetNClusters(iev);
+
+    for(Int_t k = first; k < last; k++)
+    {
+      Double_t sx = px + px2[k];
+      Double_t sy = py + py2[k];
+      Double_t sz = pz + pz2[k];
+      Double_t se = e  + e2 [k];
+
+      Double_t mm = se*se - sx*sx - sy*sy - sz*sz;
+      mass[k] = mm < 0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm);
+      pt  [k] = TMath::Sqrt(sx*sx + sy*sy);
+      esum[k] = se;
+      asym[k] = TMath::Abs(e - e2[k]) / se;
+
+      Double_t ptot2 = p2*p22[k];
+      Double_t arg   = 1.;
+      if ( ptot2 > 0 )
+      {
+        arg = (px*px2[k] + py*py2[k] + pz*pz2[k]) / TMath::Sqrt(ptot2);
+        if ( arg >  1. ) arg =  1.;
+        if ( arg < -1. ) arg = -1.;
+      }
+      angle[k] = TMath::ACos(arg);
+    }
+  }
+}
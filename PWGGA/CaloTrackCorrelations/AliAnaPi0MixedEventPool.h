@@ -0,0 +1,143 @@
+#ifndef ALIANAPI0MIXEDEVENTPOOL_H
+#define ALIANAPI0MIXEDEVENTPOOL_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliAnaPi0MixedEventPool
+/// \ingroup CaloTrackCorrelationsAnalysis
+/// \brief Compact pool of clusters of previous events for AliAnaPi0 event mixing.
+///
+/// One pool is created per centrality x z-vertex x reaction-plane bin.
+/// Instead of cloning the full AliAODPWG4Particle TClonesArray of each
+/// stored event, only the cluster four-momentum and the few flags needed by
+/// the mixed pair histograms are kept, in flat arrays organized as a ring
+/// buffer of event slots. Once the slots have reached the largest cluster
+/// multiplicity, storing a new event does not allocate any memory.
+///
+/// ComputePairs() calculates the invariant mass, pT, energy, asymmetry
+/// and opening angle of a given cluster with all the clusters stored in the
+/// pool in one go, over contiguous arrays, results are then retrieved per
+/// pool cluster index with the GetPair* methods.
+///
+/// Stored events are indexed from 0 (most recent) to GetNEvents()-1 (oldest).
+//_________________________________________________________________________
+
+// Root
+#include "TObject.h"
+#include <vector>
+
+class AliAODPWG4Particle ;
+
+class AliAnaPi0MixedEventPool : public TObject {
+
+ public:
+
+  AliAnaPi0MixedEventPool() ;
+
+  AliAnaPi0MixedEventPool(Int_t depth) ;
+
+  virtual ~AliAnaPi0MixedEventPool() { ; }
+
+  /// Bits stored in fFlags
+  enum flags { kTagged = BIT(0), kOutTimeWindow = BIT(1) } ;
+
+  void      SetDepth(Int_t depth) ;
+  Int_t     GetDepth()                       const { return fDepth    ; }
+  Int_t     GetNEvents()                     const { return fNEvents  ; }
+  void      Reset() ;
+
+  //-------------------------------
+  // Pool filling
+  //-------------------------------
+
+  void      StartEvent() ;
+  void      AddCluster(AliAODPWG4Particle * part, Int_t module, UShort_t pidMask) ;
+  Bool_t    EndEvent(Bool_t keepEmpty = kFALSE) ;
+
+  //-------------------------------
+  // Stored clusters access
+  //-------------------------------
+
+  /// \return number of clusters in stored event iev
+  Int_t     GetNClusters(Int_t iev)          const { return fNClusters[GetSlot(iev)]         ; }
+  /// \return pool index of cluster i of stored event iev
+  Int_t     GetIndex(Int_t iev, Int_t i)     const { return GetSlot(iev)*fCapacity + i       ; }
+
+  Double_t  GetPx(Int_t k)                   const { return fPx[k]                           ; }
+  Double_t  GetPy(Int_t k)                   const { return fPy[k]                           ; }
+  Double_t  GetPz(Int_t k)                   const { return fPz[k]                           ; }
+  Double_t  GetE (Int_t k)                   const { return fE [k]                           ; }
+  Float_t   GetPt(Int_t k)                   const { return fPt[k]                           ; }
+  Float_t   GetTime(Int_t k)                 const { return fTime[k]                         ; }
+  Int_t     GetModule(Int_t k)               const { return fModule[k]                       ; }
+  Int_t     GetNCells(Int_t k)               const { return fNCells[k]                       ; }
+  Int_t     GetDistToBad(Int_t k)            const { return fDistToBad[k]                    ; }
+  Int_t     GetDetectorTag(Int_t k)          const { return fDetector[k]                     ; }
+  Bool_t    IsPIDOK(Int_t k, Int_t ipid)     const { return (fPIDMask[k] >> ipid) & 1        ; }
+  Bool_t    IsTagged(Int_t k)                const { return (fFlags[k] & kTagged)        != 0; }
+  Bool_t    IsOutTimeWindow(Int_t k)         const { return (fFlags[k] & kOutTimeWindow) != 0; }
+
+  //-------------------------------
+  // Pair kinematics kernel
+  //-------------------------------
+
+  void      ComputePairs(Double_t px, Double_t py, Double_t pz, Double_t e) ;
+
+  Double_t  GetPairMass (Int_t k)            const { return fPairMass [k]                    ; }
+  Double_t  GetPairPt   (Int_t k)            const { return fPairPt   [k]                    ; }
+  Double_t  GetPairE    (Int_t k)            const { return fPairE    [k]                    ; }
+  Double_t  GetPairAsym (Int_t k)            const { return fPairAsym [k]                    ; }
+  Double_t  GetPairAngle(Int_t k)            const { return fPairAngle[k]                    ; }
+
+ private:
+
+  /// \return ring buffer slot of stored event iev, 0 being the most recent
+  Int_t     GetSlot(Int_t iev)               const { return (fHead - iev + fDepth) % fDepth  ; }
+
+  void      Resize(Int_t capacity) ;
+
+  Int_t     fDepth ;                   ///<  Maximum number of stored events
+  Int_t     fNEvents ;                 ///<  Number of stored events
+  Int_t     fHead ;                    ///<  Slot of most recent stored event
+  Int_t     fCapacity ;                ///<  Maximum number of clusters per slot
+  Int_t     fPending ;                 ///<  Number of clusters added since StartEvent()
+
+  std::vector<Int_t>    fNClusters ;   //!<! Number of clusters per slot, [fDepth]
+
+  std::vector<Double_t> fPx ;          //!<! Cluster momentum x, [fDepth*fCapacity]
+  std::vector<Double_t> fPy ;          //!<! Cluster momentum y, [fDepth*fCapacity]
+  std::vector<Double_t> fPz ;          //!<! Cluster momentum z, [fDepth*fCapacity]
+  std::vector<Double_t> fE ;           //!<! Cluster energy, [fDepth*fCapacity]
+  std::vector<Double_t> fP2 ;          //!<! Cluster momentum squared, [fDepth*fCapacity]
+  std::vector<Float_t>  fPt ;          //!<! Cluster transverse momentum, [fDepth*fCapacity]
+  std::vector<Float_t>  fTime ;        //!<! Cluster time, [fDepth*fCapacity]
+  std::vector<Short_t>  fModule ;      //!<! Cluster (super)module number, [fDepth*fCapacity]
+  std::vector<Short_t>  fNCells ;      //!<! Cluster number of cells, [fDepth*fCapacity]
+  std::vector<UShort_t> fPIDMask ;     //!<! Bit i set if cluster is photon for PID bit i, [fDepth*fCapacity]
+  std::vector<Char_t>   fDistToBad ;   //!<! Cluster distance to bad channel, [fDepth*fCapacity]
+  std::vector<Char_t>   fDetector ;    //!<! Cluster detector tag, [fDepth*fCapacity]
+  std::vector<UChar_t>  fFlags ;       //!<! Cluster flags, see enum flags, [fDepth*fCapacity]
+
+  std::vector<Double_t> fPairMass ;    //!<! Pair invariant mass from last ComputePairs() call
+  std::vector<Double_t> fPairPt ;      //!<! Pair pT from last ComputePairs() call
+  std::vector<Double_t> fPairE ;       //!<! Pair energy from last ComputePairs() call
+  std::vector<Double_t> fPairAsym ;    //!<! Pair energy asymmetry from last ComputePairs() call
+  std::vector<Double_t> fPairAngle ;   //!<! Pair opening angle from last ComputePairs() call
+
+  /// Copy constructor not implemented.
+  AliAnaPi0MixedEventPool(              const AliAnaPi0MixedEventPool & pool) ;
+
+  /// Assignment operator not implemented.
+  AliAnaPi0MixedEventPool & operator = (const AliAnaPi0MixedEventPool & pool) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliAnaPi0MixedEventPool,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALIANAPI0MIXEDEVENTPOOL_H
+
+
+
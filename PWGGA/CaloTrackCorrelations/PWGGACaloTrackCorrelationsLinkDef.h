@@ -7,6 +7,7 @@
 #pragma link C++ class AliAnaPhoton+;
 #pragma link C++ class AliAnaElectron+;
 #pragma link C++ class AliAnaPi0+;
+#pragma link C++ class AliAnaPi0MixedEventPool+;
 #pragma link C++ class AliAnaPi0EbE+;
 #pragma link C++ class AliAnaPi0Flow+;
 #pragma link C++ class AliAnaChargedParticles+;
@@ -232,6 +232,18 @@ Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePa
           Double_t maxMassForFit=fUpLimFitSteps[iMaxMass];
           Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
           ++itrial;
+          // D0 reflection templates depend only on the binning and fit range:
+          // adapt them once for all the background functions and sigma/mean configurations
+          TH1F *hReflModif=0x0;
+          TH1F *hSigModif=0x0;
+          Double_t fixSoverRefAt=-1.;
+          if(fhTemplRefl && fhTemplSign){
+            hReflModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplRefl,hRebinned,minMassForFit,maxMassForFit);
+            hSigModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplSign,hRebinned,minMassForFit,maxMassForFit);
+            if(fFixRefloS>0){
+              fixSoverRefAt=fFixRefloS*(hReflModif->Integral(hReflModif->FindBin(minMassForFit*1.0001),hReflModif->FindBin(maxMassForFit*0.999))/hSigModif->Integral(hSigModif->FindBin(minMassForFit*1.0001),hSigModif->FindBin(maxMassForFit*0.999)));
+            }
+          }
           for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
             if(typeb==kExpoBkg && !fUseExpoBkg) continue;
             if(typeb==kLinBkg && !fUseLinBkg) continue;
@@ -271,16 +283,9 @@ Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePa
 		if(typeb==kPol5Bkg) fitter->SetPolDegreeForBackgroundFit(5);
 	      }
               // D0 Reflection
-              if(fhTemplRefl && fhTemplSign){
-		TH1F *hReflModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplRefl,hRebinned,minMassForFit,maxMassForFit);
-		TH1F *hSigModif=(TH1F*)AliVertexingHFUtils::AdaptTemplateRangeAndBinning(fhTemplSign,hRebinned,minMassForFit,maxMassForFit);
-		TH1F* hrfl=fitter->SetTemplateReflections(hReflModif,"2gaus",minMassForFit,maxMassForFit);
-		if(fFixRefloS>0){
-		  Double_t fixSoverRefAt=fFixRefloS*(hReflModif->Integral(hReflModif->FindBin(minMassForFit*1.0001),hReflModif->FindBin(maxMassForFit*0.999))/hSigModif->Integral(hSigModif->FindBin(minMassForFit*1.0001),hSigModif->FindBin(maxMassForFit*0.999)));
-		  fitter->SetFixReflOverS(fixSoverRefAt);
-		}
-		delete hReflModif;
-		delete hSigModif;
+              if(hReflModif){
+		fitter->SetTemplateReflections(hReflModif,"2gaus",minMassForFit,maxMassForFit);
+		if(fFixRefloS>0) fitter->SetFixReflOverS(fixSoverRefAt);
               }
 	      if(fUseSecondPeak){
 		fitter->IncludeSecondGausPeak(fMassSecondPeak, fFixMassSecondPeak, fSigmaSecondPeak, fFixSigmaSecondPeak);
@@ -460,6 +465,8 @@ Bool_t AliHFInvMassMultiTrialFit::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePa
               fNtupleMultiTrials->Fill(xnt);
             }
           }
+          delete hReflModif;
+          delete hSigModif;
         }
       }
       delete hRebinned;
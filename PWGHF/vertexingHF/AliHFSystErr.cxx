@@ -29,6 +29,10 @@
 // syst.DrawErrors(); // to see a plot of the error contributions
 // syst.GetTotalSystErr(pt); // to get the total err at pt 
 //
+// The histos of each configuration are built once per session and shared
+// by the instances initialized with the same settings, the sharing can be
+// switched off with AliHFSystErr::SetUseTablesCache(kFALSE)
+//
 // Author: A.Dainese, andrea.dainese@pd.infn.it
 /////////////////////////////////////////////////////////////
 
@@ -39,6 +43,8 @@
 #include <TH2F.h>
 #include <TLegend.h>
 #include <TColor.h>
+#include <TList.h>
+#include <TObjArray.h>
 
 #include "AliLog.h"
 #include "AliHFSystErr.h"
@@ -47,6 +53,11 @@
 ClassImp(AliHFSystErr);
 /// \endcond
 
+TList *AliHFSystErr::fgTablesCache = 0x0;
+Bool_t AliHFSystErr::fgUseTablesCache = kTRUE;
+// placeholder for the name and title not set by the Init functions
+static const char *kTablesUnset = "AliHFSystErr::unset";
+
 //--------------------------------------------------------------------------
 AliHFSystErr::AliHFSystErr(const Char_t* name, const Char_t* title) : 
   TNamed(name,title),
@@ -97,6 +108,80 @@ AliHFSystErr::~AliHFSystErr() {
 void AliHFSystErr::Init(Int_t decay){
   //
   /// Variables/histos initialization
+  /// The histos of a given configuration are built once and then shared
+  /// by all the instances initialized with the same settings
+  //
+
+  Bool_t isEmpty = !fNorm && !fRawYield && !fTrackingEff && !fBR &&
+    !fCutsEff && !fPIDEff && !fMCPtShape && !fPartAntipart;
+  if(!fgUseTablesCache || !isEmpty) {
+    InitTables(decay);
+    return;
+  }
+
+  if(!fgTablesCache) fgTablesCache = new TList();
+  TString key = GetTablesKey(decay);
+  TObjArray *tables = (TObjArray*)fgTablesCache->FindObject(key.Data());
+
+  if(!tables) {
+    // name and title are replaced by a placeholder to see whether the Init function sets them
+    TString name = GetName();
+    TString title = GetTitle();
+    SetNameTitle(kTablesUnset,kTablesUnset);
+    InitTables(decay);
+    TNamed *named = 0x0;
+    if(fName!=kTablesUnset || fTitle!=kTablesUnset) named = new TNamed(GetName(),GetTitle());
+    if(fName==kTablesUnset) SetName(name.Data());
+    if(fTitle==kTablesUnset) SetTitle(title.Data());
+
+    // the cached histos are detached from the current directory,
+    // they must survive the closing of the files opened by the user
+    tables = new TObjArray(kNTables+1);
+    tables->SetName(key.Data());
+    TH1F **hists[kNTables] = {&fNorm,&fRawYield,&fTrackingEff,&fBR,&fCutsEff,&fPIDEff,&fMCPtShape,&fPartAntipart};
+    for(Int_t i=0; i<kNTables; i++) {
+      if(*hists[i]) (*hists[i])->SetDirectory(0);
+      tables->AddAt(*hists[i],i);
+    }
+    // keep the name and title set by the Init function
+    if(named) tables->AddAt(named,kNTables);
+    fgTablesCache->Add(tables);
+    return;
+  }
+
+  AliInfo(Form(" Using the cached settings %s",key.Data()));
+  fNorm         = (TH1F*)tables->At(0);
+  fRawYield     = (TH1F*)tables->At(1);
+  fTrackingEff  = (TH1F*)tables->At(2);
+  fBR           = (TH1F*)tables->At(3);
+  fCutsEff      = (TH1F*)tables->At(4);
+  fPIDEff       = (TH1F*)tables->At(5);
+  fMCPtShape    = (TH1F*)tables->At(6);
+  fPartAntipart = (TH1F*)tables->At(7);
+  TNamed *named = (TNamed*)tables->At(kNTables);
+  if(named) {
+    if(TString(named->GetName())!=kTablesUnset) SetName(named->GetName());
+    if(TString(named->GetTitle())!=kTablesUnset) SetTitle(named->GetTitle());
+  }
+
+}
+
+//--------------------------------------------------------------------------
+TString AliHFSystErr::GetTablesKey(Int_t decay) const {
+  //
+  /// Key of the cached histos, built from all the settings used by Init
+  //
+
+  return TString::Format("%d_%d_%d_%s_%s_%d%d%d%d%d%d%d",decay,fRunNumber,fCollisionType,
+			 fCentralityClass.Data(),fRapidityRange.Data(),
+			 fIsLowEnergy,fIsLowPtAnalysis,fIsPass4Analysis,fIs5TeVAnalysis,
+			 fIsBDTAnalysis,fIsCentScan,fIsRapidityScan);
+}
+
+//--------------------------------------------------------------------------
+void AliHFSystErr::InitTables(Int_t decay){
+  //
+  /// Build the histos of the selected configuration
   //
 
   //  if ((fRunNumber>11) && fIsLowEnergy==false) {
@@ -6628,7 +6713,9 @@ Double_t AliHFSystErr::GetSeleEffErr(Double_t pt) const {
   // Get error
   //
 
-  Double_t err=GetCutsEffErr(pt)*GetCutsEffErr(pt)+GetMCPtShapeErr(pt)*GetMCPtShapeErr(pt);
+  Double_t cutsEffErr=GetCutsEffErr(pt);
+  Double_t mcPtShapeErr=GetMCPtShapeErr(pt);
+  Double_t err=cutsEffErr*cutsEffErr+mcPtShapeErr*mcPtShapeErr;
 
   return TMath::Sqrt(err);
 }
@@ -6680,13 +6767,15 @@ Double_t AliHFSystErr::GetTotalSystErr(Double_t pt,Double_t feeddownErr) const {
 
   Double_t err=0.;
 
-  if(fRawYield) err += GetRawYieldErr(pt)*GetRawYieldErr(pt);
-  if(fTrackingEff) err += GetTrackingEffErr(pt)*GetTrackingEffErr(pt);
+  // each contribution is looked up once
+  Double_t e=0.;
+  if(fRawYield) { e=GetRawYieldErr(pt); err += e*e; }
+  if(fTrackingEff) { e=GetTrackingEffErr(pt); err += e*e; }
   //  if(fBR) err += GetBRErr()*GetBRErr();
-  if(fCutsEff) err += GetCutsEffErr(pt)*GetCutsEffErr(pt);
-  if(fPIDEff) err += GetPIDEffErr(pt)*GetPIDEffErr(pt);
-  if(fMCPtShape) err += GetMCPtShapeErr(pt)*GetMCPtShapeErr(pt);
-  if(fPartAntipart) err += GetPartAntipartErr(pt)*GetPartAntipartErr(pt);
+  if(fCutsEff) { e=GetCutsEffErr(pt); err += e*e; }
+  if(fPIDEff) { e=GetPIDEffErr(pt); err += e*e; }
+  if(fMCPtShape) { e=GetMCPtShapeErr(pt); err += e*e; }
+  if(fPartAntipart) { e=GetPartAntipartErr(pt); err += e*e; }
 
   err += feeddownErr*feeddownErr;
 
@@ -17,6 +17,8 @@
 #include "AliLog.h"
 #include "TGraphAsymmErrors.h"
 
+class TList;
+
 
 class AliHFSystErr : public TNamed 
 {
@@ -100,6 +102,8 @@ class AliHFSystErr : public TNamed
 
   /// Function to initialize the variables/histograms
   void Init(Int_t decay);
+  /// Share the histos of identical configurations between the instances (default)
+  static void SetUseTablesCache(Bool_t flag=kTRUE) { fgUseTablesCache = flag; }
 
   void InitD0toKpi2010PbPb010CentScan();
   void InitD0toKpi2010PbPb1020CentScan();
@@ -290,6 +294,10 @@ class AliHFSystErr : public TNamed
 
 
   TH1F* ReflectHisto(TH1F *hin) const;
+  void InitTables(Int_t decay);
+  TString GetTablesKey(Int_t decay) const;
+
+  enum { kNTables=8 };    /// number of histos of a configuration
 
   TH1F *fNorm;            /// normalization
   TH1F *fRawYield;        /// raw yield 
@@ -314,6 +322,9 @@ class AliHFSystErr : public TNamed
   Bool_t fIsCentScan;      /// flag fot the PbPb centrality scan
   Bool_t fIsRapidityScan;  /// flag for the pPb vs y measurement
 
+  static TList *fgTablesCache;    //! histos of the configurations already initialized
+  static Bool_t fgUseTablesCache; //! share the histos of identical configurations
+
   /// \cond CLASSIMP    
   ClassDef(AliHFSystErr,9);  /// class for systematic errors of charm hadrons
   /// \endcond
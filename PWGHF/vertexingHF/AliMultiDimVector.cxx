@@ -400,21 +400,39 @@ void AliMultiDimVector::Sqrt(const AliMultiDimVector* mv){
 }
 //_____________________________________________________________________________
 void AliMultiDimVector::FindMaximum(Float_t& maxValue, Int_t *ind , Int_t ptbin){
-  // finds the element with maximum contents
-  const ULong64_t nelem=fNTotCells/fNPtBins;
-  TArrayF vett;
-  vett.Set(nelem);
-  ULong64_t runningAddress;
-  for(ULong64_t i=0;i<nelem;i++){
-    runningAddress=ptbin+i*fNPtBins;
-    vett.AddAt(fVett[runningAddress],i);
-  }
-  maxValue=TMath::MaxElement(nelem,vett.GetArray());
-  ULong64_t maxAddress=TMath::LocMax(nelem,vett.GetArray());
-  ULong64_t maxGlobalAddress=ptbin+maxAddress*fNPtBins;
+  // finds the element with maximum contents (the first one in case of ties)
+  ULong64_t maxGlobalAddress=ptbin;
+  maxValue=fVett[maxGlobalAddress];
+  for(ULong64_t runningAddress=ptbin+fNPtBins;runningAddress<fNTotCells;runningAddress+=fNPtBins){
+    if(fVett[runningAddress]>maxValue){
+      maxValue=fVett[runningAddress];
+      maxGlobalAddress=runningAddress;
+    }
+  }
   Int_t checkedptbin;
   GetIndicesFromGlobalAddress(maxGlobalAddress,ind,checkedptbin);
 }
+//_____________________________________________________________________________
+void AliMultiDimVector::FindMaximumAllPtBins(Float_t *maxValues, Int_t *ind){
+  // finds the element with maximum contents for all the pt bins
+  // in a single pass over the matrix:
+  // maxValues[fNPtBins], indices of the cells in ind[ptbin*fNVariables+iVar]
+  ULong64_t maxGlobalAddress[fgkMaxNPtBins];
+  for(Int_t ipt=0;ipt<fNPtBins;ipt++){
+    maxGlobalAddress[ipt]=ipt;
+    maxValues[ipt]=fVett[ipt];
+  }
+  for(ULong64_t first=fNPtBins;first<fNTotCells;first+=fNPtBins){
+    for(Int_t ipt=0;ipt<fNPtBins;ipt++){
+      if(fVett[first+ipt]>maxValues[ipt]){
+	maxValues[ipt]=fVett[first+ipt];
+	maxGlobalAddress[ipt]=first+ipt;
+      }
+    }
+  }
+  Int_t checkedptbin;
+  for(Int_t ipt=0;ipt<fNPtBins;ipt++) GetIndicesFromGlobalAddress(maxGlobalAddress[ipt],&ind[ipt*fNVariables],checkedptbin);
+}
 
 //_____________________________________________________________________________
 //Int_t* AliMultiDimVector::FindLocalMaximum(Float_t& maxValue, Bool_t *isFree,Int_t* indFixed, Int_t ptbin){
@@ -541,14 +559,26 @@ void  AliMultiDimVector::GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, In
 }
 //_____________________________________________________________________________ 
 void AliMultiDimVector::Integrate(){
-  // integrates the matrix
+  // integrates the matrix: each cell gets the sum of the cells passing its cuts
+  // (same result as CountsAboveCell for all the cells).
+  // The cumulative sums are done one variable at a time, starting from the
+  // tightest cut, so the cost is fNTotCells*fNVariables additions.
+  // Filling with Fill and integrating once at the end is equivalent to
+  // FillAndIntegrate for each candidate
   if(fIsIntegrated){
     AliError("MultiDimVector already integrated");
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
-  for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
+  // pt bin is the fastest index of the global address
+  ULong64_t stride=fNPtBins;
+  for(Int_t iVar=fNVariables-1;iVar>=0;iVar--){
+    ULong64_t block=stride*fNCutSteps[iVar];
+    if(block==0) break;
+    for(ULong64_t first=0;first<fNTotCells;first+=block){
+      for(ULong64_t j=block-stride;j-->0;) fVett[first+j]+=fVett[first+j+stride];
+    }
+    stride=block;
+  }
   fIsIntegrated=kTRUE;
 }//_____________________________________________________________________________ 
 ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
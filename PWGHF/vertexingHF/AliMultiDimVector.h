@@ -95,6 +95,9 @@ class AliMultiDimVector :  public TNamed{
     SetElement(globadd,GetElement(globadd)+1.);
   }
 
+  /// Fill fills only the cell of the candidate, FillAndIntegrate all the cells
+  /// whose cuts are passed; for many candidates Fill followed by a single
+  /// Integrate at the end gives the same matrix at a much lower cost
   void Fill(Float_t* values, Int_t ptbin);
   void FillAndIntegrate(Float_t* values, Int_t ptbin);
   void Integrate();
@@ -114,6 +117,7 @@ class AliMultiDimVector :  public TNamed{
   void Sqrt(const AliMultiDimVector* mv);
   
   void FindMaximum(Float_t& max_value, Int_t *ind, Int_t ptbin); 
+  void FindMaximumAllPtBins(Float_t *maxValues, Int_t *ind);
   Int_t* FindLocalMaximum(Float_t& maxValue, Int_t *numFixed,Int_t* indFixed, Int_t nfixed,Int_t ptbin);
 
   TH2F*  Project(Int_t firstVar, Int_t secondVar, const Int_t* fixedVars, Int_t ptbin, Float_t norm=1.);
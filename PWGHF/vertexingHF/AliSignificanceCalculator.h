@@ -68,6 +68,10 @@ class AliSignificanceCalculator : public TObject{
     if(fSignificance) fSignificance->FindMaximum(sigMax,cutIndices,ptbin);
     return sigMax;
   }
+  void GetMaxSignificances(Float_t* sigMax, Int_t* cutIndices) const{
+    /// maxima for all the pt bins in one pass, cutIndices[ptbin*nVariables+iVar]
+    if(fSignificance) fSignificance->FindMaximumAllPtBins(sigMax,cutIndices);
+  }
   AliMultiDimVector* CalculatePurity() const;
   AliMultiDimVector* CalculatePurityError() const;
   AliMultiDimVector* CalculateSOverB() const;
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliEmcalRhoMedian.h"
 
 ClassImp(AliAnalysisTaskRho)
 
@@ -79,7 +80,8 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  fRhoValues.resize(Njets);
+  Double_t *rhovec = Njets > 0 ? &fRhoValues[0] : 0;
   Int_t NjetAcc = 0;
 
   // push all jets within selected acceptance into stack
@@ -105,7 +107,7 @@ Bool_t AliAnalysisTaskRho::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = AliEmcalRhoMedian::Median(NjetAcc, rhovec);
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
@@ -56,7 +56,8 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase() :
   fHistDeltaRhovsNtrack(0),
   fHistDeltaRhoScalevsNtrack(0),
   fHistRhovsNcluster(0),
-  fHistRhoScaledvsNcluster(0)
+  fHistRhoScaledvsNcluster(0),
+  fRhoValues()
 {
   // Constructor.
 
@@ -101,7 +102,8 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   fHistDeltaRhovsNtrack(0),
   fHistDeltaRhoScalevsNtrack(0),
   fHistRhovsNcluster(0),
-  fHistRhoScaledvsNcluster(0)
+  fHistRhoScaledvsNcluster(0),
+  fRhoValues()
 {
   // Constructor.
 
@@ -10,6 +10,8 @@ class TH2F;
 class TH3F;
 class AliRhoParameter;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
@@ -80,9 +82,11 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   TH2F                  *fHistRhovsNcluster;             //!rho vs. no. of clusters
   TH2F                  *fHistRhoScaledvsNcluster;       //!rhoscaled vs. no. of clusters
 
+  std::vector<Double_t>  fRhoValues;                     //!jet pt/area values of the accepted jets
+
   AliAnalysisTaskRhoBase(const AliAnalysisTaskRhoBase&);             // not implemented
   AliAnalysisTaskRhoBase& operator=(const AliAnalysisTaskRhoBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoBase, 11); // Rho base task
+  ClassDef(AliAnalysisTaskRhoBase, 12); // Rho base task
 };
 #endif
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliEmcalRhoMedian.h"
 
 ClassImp(AliAnalysisTaskRhoMass)
 
@@ -101,9 +102,12 @@ Bool_t AliAnalysisTaskRhoMass::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
+  fRhoMassValues.resize(Njets);
+  fJetEValues.resize(Njets);
+  fJetMValues.resize(Njets);
+  Double_t *rhomvec = Njets > 0 ? &fRhoMassValues[0] : 0;
+  Double_t *Evec = Njets > 0 ? &fJetEValues[0] : 0;
+  Double_t *Mvec = Njets > 0 ? &fJetMValues[0] : 0;
   Int_t NjetAcc = 0;
 
   // push all jets within selected acceptance into stack
@@ -137,7 +141,7 @@ Bool_t AliAnalysisTaskRhoMass::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = AliEmcalRhoMedian::Median(NjetAcc, rhomvec);
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
@@ -45,7 +45,10 @@ AliAnalysisTaskRhoMassBase::AliAnalysisTaskRhoMassBase() :
   fHistDeltaRhoMassScalevsNtrack(0),
   fHistRhoMassvsNcluster(0),
   fHistRhoMassScaledvsNcluster(0),
-  fHistGammaVsNtrack(0)
+  fHistGammaVsNtrack(0),
+  fRhoMassValues(),
+  fJetEValues(),
+  fJetMValues()
 {
   // Constructor.
 }
@@ -75,7 +78,10 @@ AliAnalysisTaskRhoMassBase::AliAnalysisTaskRhoMassBase(const char *name, Bool_t
   fHistDeltaRhoMassScalevsNtrack(0),
   fHistRhoMassvsNcluster(0),
   fHistRhoMassScaledvsNcluster(0),
-  fHistGammaVsNtrack(0)
+  fHistGammaVsNtrack(0),
+  fRhoMassValues(),
+  fJetEValues(),
+  fJetMValues()
 {
   // Constructor.
 
@@ -9,6 +9,8 @@ class TH1F;
 class TH2F;
 class AliRhoParameter;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskRhoMassBase : public AliAnalysisTaskEmcalJet {
@@ -70,9 +72,13 @@ class AliAnalysisTaskRhoMassBase : public AliAnalysisTaskEmcalJet {
 
   TH2F                  *fHistGammaVsNtrack;             //!Gamma(<E>/<M>) vs Ntrack
 
+  std::vector<Double_t>  fRhoMassValues;                 //!jet md/area values of the accepted jets
+  std::vector<Double_t>  fJetEValues;                    //!energy of the accepted jets
+  std::vector<Double_t>  fJetMValues;                    //!mass of the accepted jets
+
   AliAnalysisTaskRhoMassBase(const AliAnalysisTaskRhoMassBase&);             // not implemented
   AliAnalysisTaskRhoMassBase& operator=(const AliAnalysisTaskRhoMassBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMassBase, 2); // Rho mass base task
+  ClassDef(AliAnalysisTaskRhoMassBase, 3); // Rho mass base task
 };
 #endif
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliEmcalRhoMedian.h"
 #include "AliJetContainer.h"
 
 ClassImp(AliAnalysisTaskRhoMassSparse)
@@ -137,9 +138,12 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
+  fRhoMassValues.resize(Njets);
+  fJetEValues.resize(Njets);
+  fJetMValues.resize(Njets);
+  Double_t *rhomvec = Njets > 0 ? &fRhoMassValues[0] : 0;
+  Double_t *Evec = Njets > 0 ? &fJetEValues[0] : 0;
+  Double_t *Mvec = Njets > 0 ? &fJetMValues[0] : 0;
   Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
@@ -211,7 +215,7 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = AliEmcalRhoMedian::Median(NjetAcc, rhomvec);
     if(fRhoCMS){
       rhom = rhom * OccCorr;
     }
@@ -15,6 +15,7 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliEmcalRhoMedian.h"
 #include "AliJetContainer.h"
 
 ClassImp(AliAnalysisTaskRhoSparse)
@@ -126,7 +127,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  fRhoValues.resize(Njets);
+  Double_t *rhovec = Njets > 0 ? &fRhoValues[0] : 0;
   Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
@@ -189,7 +191,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
 
   if (NjetAcc > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = AliEmcalRhoMedian::Median(NjetAcc, rhovec);
 
     if(fRhoCMS){
       rho = rho * OccCorr;
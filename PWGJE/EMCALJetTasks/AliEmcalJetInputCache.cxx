@@ -0,0 +1,142 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <AliAnalysisManager.h>
+#include <AliVEvent.h>
+#include <AliLog.h>
+
+#include "AliEmcalJetInputCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalJetInputCache);
+/// \endcond
+
+AliEmcalJetInputCache* AliEmcalJetInputCache::fgInstance = 0;
+
+/**
+ * Default constructor.
+ */
+AliEmcalJetInputCache::AliEmcalJetInputCache() :
+  TObject(),
+  fEvent(0),
+  fEntry(-1),
+  fTags(),
+  fSignatures(),
+  fFilled(),
+  fMomentum(),
+  fUserIndex()
+{
+}
+
+/**
+ * @return The instance shared by all the jet tasks
+ */
+AliEmcalJetInputCache* AliEmcalJetInputCache::Instance()
+{
+  if (!fgInstance) fgInstance = new AliEmcalJetInputCache();
+  return fgInstance;
+}
+
+/**
+ * Invalidates all the slots if the event or the analysis manager entry changed.
+ * The memory of the slots is kept for the next event.
+ * @param event Current input event
+ */
+void AliEmcalJetInputCache::CheckEvent(const AliVEvent* event)
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (event == fEvent && entry == fEntry) return;
+
+  fEvent = event;
+  fEntry = entry;
+  for (UInt_t i = 0; i < fFilled.size(); i++) fFilled[i] = kFALSE;
+}
+
+/**
+ * Finds the slot of a given tag. The signature of the input must match
+ * the one the tag was first used with, otherwise the analysis is stopped.
+ * @param tag Shared input tag
+ * @param signature Input containers and cuts (AliEmcalJetTask::GetInputSignature)
+ * @return Slot of the tag, -1 if the tag was not used yet
+ */
+Int_t AliEmcalJetInputCache::GetSlot(const TString& tag, const TString& signature) const
+{
+  for (UInt_t i = 0; i < fTags.size(); i++) {
+    if (fTags[i] != tag) continue;
+    if (fSignatures[i] != signature) {
+      AliFatal(Form("Shared input tag '%s' used with the input containers '%s' and '%s'", tag.Data(), fSignatures[i].Data(), signature.Data()));
+    }
+    return i;
+  }
+  return -1;
+}
+
+/**
+ * Looks for the input vectors stored with a given tag in the current event.
+ * @param tag Shared input tag
+ * @param signature Input containers and cuts (AliEmcalJetTask::GetInputSignature)
+ * @param event Current input event
+ * @return Slot of the input vectors, -1 if they were not stored yet in this event
+ */
+Int_t AliEmcalJetInputCache::FindInput(const TString& tag, const TString& signature, const AliVEvent* event)
+{
+  CheckEvent(event);
+  Int_t slot = GetSlot(tag, signature);
+  return (slot >= 0 && fFilled[slot]) ? slot : -1;
+}
+
+/**
+ * Prepares a slot to record the input vectors of a given tag in the current event.
+ * @param tag Shared input tag
+ * @param signature Input containers and cuts (AliEmcalJetTask::GetInputSignature)
+ * @param event Current input event
+ * @return Slot where the input vectors are to be added
+ */
+Int_t AliEmcalJetInputCache::StartInput(const TString& tag, const TString& signature, const AliVEvent* event)
+{
+  CheckEvent(event);
+  Int_t slot = GetSlot(tag, signature);
+  if (slot < 0) {
+    slot = fTags.size();
+    fTags.push_back(tag);
+    fSignatures.push_back(signature);
+    fFilled.push_back(kFALSE);
+    fMomentum.push_back(std::vector<Double_t>());
+    fUserIndex.push_back(std::vector<Int_t>());
+  }
+  fMomentum[slot].clear();
+  fUserIndex[slot].clear();
+  fFilled[slot] = kTRUE;
+  return slot;
+}
+
+/**
+ * Records an input vector.
+ * @param slot Slot returned by StartInput()
+ * @param px x component of the momentum
+ * @param py y component of the momentum
+ * @param pz z component of the momentum
+ * @param E Energy
+ * @param index User index of the input vector
+ */
+void AliEmcalJetInputCache::AddInputVector(Int_t slot, Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index)
+{
+  fMomentum[slot].push_back(px);
+  fMomentum[slot].push_back(py);
+  fMomentum[slot].push_back(pz);
+  fMomentum[slot].push_back(E);
+  fUserIndex[slot].push_back(index);
+}
@@ -0,0 +1,70 @@
+#ifndef ALIEMCALJETINPUTCACHE_H
+#define ALIEMCALJETINPUTCACHE_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <TObject.h>
+#include <TString.h>
+
+class AliVEvent;
+
+/**
+ * @class AliEmcalJetInputCache
+ * @brief Event-scoped store of jet finder input vectors shared by several AliEmcalJetTask
+ *
+ * Trains often run several jet finders (different radii, algorithms,
+ * kt for the background) on the same track and cluster containers. Jet
+ * tasks configured with the same shared input tag (AliEmcalJetTask::SetSharedInputTag)
+ * store their input vectors here: the first task of the event loops over the containers
+ * and records the accepted constituents in flat arrays, the following tasks
+ * feed the recorded constituents to their FastJet wrapper directly.
+ *
+ * The stored input vectors are invalidated when the event or the analysis
+ * manager entry changes. Each tag is bound to the signature of the input
+ * (names, order and acceptance cuts of the particle and cluster containers,
+ * artificial tracking inefficiency) of the first task
+ * using it: a task with the same tag and a different signature is a
+ * configuration error and stops the analysis.
+ */
+class AliEmcalJetInputCache : public TObject {
+ public:
+
+  AliEmcalJetInputCache();
+  virtual ~AliEmcalJetInputCache() {}
+
+  static AliEmcalJetInputCache* Instance();
+
+  Int_t           FindInput(const TString& tag, const TString& signature, const AliVEvent* event);
+  Int_t           StartInput(const TString& tag, const TString& signature, const AliVEvent* event);
+  void            AddInputVector(Int_t slot, Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index);
+
+  Int_t           GetNInputVectors(Int_t slot)          const { return fUserIndex[slot].size()   ; }
+  const Double_t* GetMomentum(Int_t slot, Int_t i)      const { return &fMomentum[slot][4*i]     ; }
+  Int_t           GetUserIndex(Int_t slot, Int_t i)     const { return fUserIndex[slot][i]       ; }
+
+ private:
+
+  void            CheckEvent(const AliVEvent* event);
+  Int_t           GetSlot(const TString& tag, const TString& signature) const;
+
+  AliEmcalJetInputCache(const AliEmcalJetInputCache&);            // not implemented
+  AliEmcalJetInputCache &operator=(const AliEmcalJetInputCache&); // not implemented
+
+  const AliVEvent                    *fEvent;      //!<! event the input vectors belong to
+  Long64_t                            fEntry;      //!<! analysis manager entry the input vectors belong to
+  std::vector<TString>                fTags;       //!<! shared input tag of each slot
+  std::vector<TString>                fSignatures; //!<! input containers and cuts of each slot
+  std::vector<Bool_t>                 fFilled;     //!<! true if the slot was filled in the current event
+  std::vector<std::vector<Double_t> > fMomentum;   //!<! px, py, pz, E of the input vectors of each slot
+  std::vector<std::vector<Int_t> >    fUserIndex;  //!<! user index of the input vectors of each slot
+
+  static AliEmcalJetInputCache       *fgInstance;  //!<! shared instance
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetInputCache, 2);
+  /// \endcond
+};
+#endif
@@ -33,6 +33,7 @@
 #include "AliEmcalParticle.h"
 #include "AliFJWrapper.h"
 #include "AliEmcalJetUtility.h"
+#include "AliEmcalJetInputCache.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 
@@ -70,6 +71,7 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fUtilities(0),
   fLocked(0),
+  fSharedInputTag(),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -105,6 +107,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fUtilities(0),
   fLocked(0),
+  fSharedInputTag(),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -216,10 +219,11 @@ Bool_t AliEmcalJetTask::Run()
 }
 
 /**
- * This method steers the jet finding. It first loops over all particle and cluster containers
- * that were provided when the task was initialized. All accepted objects (tracks, particle, clusters)
- * are added as input vectors to the FastJet wrapper. Then the jet finding is launched
- * in the wrapper.
+ * This method steers the jet finding. The input vectors are added to the FastJet wrapper,
+ * either from the containers or, if a shared input tag is set and another jet task
+ * with the same tag already ran in this event, from the input vectors it stored
+ * in AliEmcalJetInputCache. Then the jet finding is launched in the wrapper.
+ * Input vectors are not shared if an artificial tracking inefficiency is applied.
  * @return Total number of jets found.
  */
 Int_t AliEmcalJetTask::FindJets()
@@ -233,6 +237,73 @@ Int_t AliEmcalJetTask::FindJets()
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  if (!fSharedInputTag.IsNull() && fTrackEfficiency >= 1.) {
+    AliEmcalJetInputCache *cache = AliEmcalJetInputCache::Instance();
+    TString signature = GetInputSignature();
+    Int_t slot = cache->FindInput(fSharedInputTag, signature, InputEvent());
+    if (slot >= 0) {
+      AliDebug(2,Form("Using the %d input vectors shared with tag '%s'", cache->GetNInputVectors(slot), fSharedInputTag.Data()));
+      for (Int_t i = 0; i < cache->GetNInputVectors(slot); i++) {
+        const Double_t *p = cache->GetMomentum(slot, i);
+        fFastJetWrapper.AddInputVector(p[0], p[1], p[2], p[3], cache->GetUserIndex(slot, i));
+      }
+    }
+    else {
+      AddInputVectors(cache, cache->StartInput(fSharedInputTag, signature, InputEvent()));
+    }
+  }
+  else {
+    AddInputVectors(0, -1);
+  }
+
+  if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
+
+  // run jet finder
+  fFastJetWrapper.Run();
+
+  return fFastJetWrapper.GetInclusiveJets().size();
+}
+
+/**
+ * Builds the signature of the input vectors, used to check that the jet tasks
+ * sharing their input vectors run on the same containers in the same order
+ * (the order defines the user index of the constituents) with the same
+ * acceptance cuts and the same artificial tracking inefficiency.
+ * @return Names and cuts of the particle and cluster containers, tracking efficiency settings
+ */
+TString AliEmcalJetTask::GetInputSignature() const
+{
+  TString signature(Form("eff:%g,%d tracks:", fTrackEfficiency, fTrackEfficiencyOnlyForEmbedding));
+  TIter nextPartColl(&fParticleCollArray);
+  AliParticleContainer* tracks = 0;
+  while ((tracks = static_cast<AliParticleContainer*>(nextPartColl()))) {
+    signature += Form("%s(pt %g-%g,E %g-%g,eta %g-%g,phi %g-%g),", tracks->GetName(),
+                      tracks->GetMinPt(), tracks->GetMaxPt(), tracks->GetMinE(), tracks->GetMaxE(),
+                      tracks->GetMinEta(), tracks->GetMaxEta(), tracks->GetMinPhi(), tracks->GetMaxPhi());
+  }
+  signature += " clusters:";
+  TIter nextClusColl(&fClusterCollArray);
+  AliClusterContainer* clusters = 0;
+  while ((clusters = static_cast<AliClusterContainer*>(nextClusColl()))) {
+    signature += Form("%s(pt %g-%g,E %g-%g,eta %g-%g,phi %g-%g,energy %d,Ecut", clusters->GetName(),
+                      clusters->GetMinPt(), clusters->GetMaxPt(), clusters->GetMinE(), clusters->GetMaxE(),
+                      clusters->GetMinEta(), clusters->GetMaxEta(), clusters->GetMinPhi(), clusters->GetMaxPhi(),
+                      clusters->GetDefaultClusterEnergy());
+    for (Int_t t = 0; t <= AliVCluster::kLastUserDefEnergy; t++) signature += Form(" %g", clusters->GetClusUserDefEnergyCut(t));
+    signature += "),";
+  }
+  return signature;
+}
+
+/**
+ * This method loops over all particle and cluster containers that were provided
+ * when the task was initialized. All accepted objects (tracks, particle, clusters)
+ * are added as input vectors to the FastJet wrapper.
+ * @param cache If not null, the input vectors are also recorded in this cache
+ * @param slot Slot of the cache where the input vectors are recorded
+ */
+void AliEmcalJetTask::AddInputVectors(AliEmcalJetInputCache *cache, Int_t slot)
+{
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
   AliParticleContainer* tracks = 0;
@@ -254,6 +325,7 @@ Int_t AliEmcalJetTask::FindJets()
       AliDebug(2,Form("Track %d accepted (label = %d, pt = %f, eta = %f, phi = %f, E = %f, m = %f, px = %f, py = %f, pz = %f)", it.current_index(), it->second->GetLabel(), it->first.Pt(), it->first.Eta(), it->first.Phi(), it->first.E(), it->first.M(), it->first.Px(), it->first.Py(), it->first.Pz()));
       Int_t uid = it.current_index() + fgkConstIndexShift * iColl;
       fFastJetWrapper.AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+      if (cache) cache->AddInputVector(slot, it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
     }
     iColl++;
   }
@@ -268,16 +340,10 @@ Int_t AliEmcalJetTask::FindJets()
       AliDebug(2,Form("Cluster %d accepted (label = %d, energy = %.3f)", it.current_index(), it->second->GetLabel(), it->first.E()));
       Int_t uid = -it.current_index() - fgkConstIndexShift * iColl;
       fFastJetWrapper.AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+      if (cache) cache->AddInputVector(slot, it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
     }
     iColl++;
   }
-
-  if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
-
-  // run jet finder
-  fFastJetWrapper.Run();
-
-  return fFastJetWrapper.GetInclusiveJets().size();
 }
 
 /**
@@ -8,6 +8,7 @@ class TClonesArray;
 class TObjArray;
 class AliVEvent;
 class AliEmcalJetUtility;
+class AliEmcalJetInputCache;
 
 #include <AliLog.h>
 
@@ -40,6 +41,11 @@ namespace fastjet {
  * defined as being charged, neutral or full. The jet finding is delegated to
  * the class AliFJWrapper which implements an interface to FastJet.
  *
+ * Jet tasks running on the same constituent selection can share their input
+ * vectors through AliEmcalJetInputCache by setting the same tag with SetSharedInputTag():
+ * only the first of them in the event loops over the containers. Tasks with the same tag
+ * must use the same particle and cluster containers, in the same order and with the same cuts.
+ *
  * The FastJet contrib utilities are available via the AliEmcalJetUtility base class
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
@@ -79,6 +85,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetSharedInputTag(const char *t)           { fSharedInputTag = t; } // allowed on locked tasks, the jet definition is unchanged
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -105,6 +112,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Int_t                  GetRecombScheme()                { return fRecombScheme      ; }
   Double_t               GetTrackEfficiency()             { return fTrackEfficiency   ; }
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
+  const char*            GetSharedInputTag()              { return fSharedInputTag.Data(); }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
@@ -143,6 +151,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  protected:
 
   Int_t                  FindJets();
+  void                   AddInputVectors(AliEmcalJetInputCache *cache, Int_t slot);
+  TString                GetInputSignature() const;
   void                   FillJetBranch();
   void                   ExecOnce();
   void                   InitEvent();
@@ -173,6 +183,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TObjArray             *fUtilities;              // jet utilities (gen subtractor, constituent subtractor etc.)
   Bool_t                 fTrackEfficiencyOnlyForEmbedding; // Apply aritificial tracking inefficiency only for embedded tracks
   Bool_t                 fLocked;                 // true if lock is set
+  TString                fSharedInputTag;         // input vectors shared with the jet tasks with the same tag (empty = not shared)
 
   TString                fJetsName;               //!name of jet collection
   Bool_t                 fIsInit;                 //!=true if already initialized
@@ -197,7 +208,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 24);
+  ClassDef(AliEmcalJetTask, 25);
   /// \endcond
 };
 #endif
@@ -0,0 +1,23 @@
+// $Id$
+//
+// Median of the jet pt/area (or mass/area) values used by the rho tasks.
+
+#include "AliEmcalRhoMedian.h"
+
+#include <algorithm>
+
+//________________________________________________________________________
+Double_t AliEmcalRhoMedian::Median(Int_t n, Double_t *values)
+{
+  // Median of the first n values, the array is partially reordered.
+
+  if (n <= 0 || !values) return 0;
+
+  Double_t *mid = values + n/2;
+  std::nth_element(values, mid, values + n);
+  if (n%2 == 1) return *mid;
+
+  // the lower central value is the largest one of the lower partition
+  Double_t lower = *std::max_element(values, mid);
+  return 0.5*(lower + *mid);
+}
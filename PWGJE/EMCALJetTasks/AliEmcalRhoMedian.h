@@ -0,0 +1,18 @@
+#ifndef ALIEMCALRHOMEDIAN_H
+#define ALIEMCALRHOMEDIAN_H
+
+// $Id$
+
+#include <Rtypes.h>
+
+//
+// Median of the jet pt/area (or mass/area) values used by the rho tasks.
+// The median is obtained with a linear time selection on the input array
+// instead of the index sort and work array of TMath::Median; the value is
+// the same: for an even number of entries the two central values are averaged.
+//
+class AliEmcalRhoMedian {
+ public:
+  static Double_t Median(Int_t n, Double_t *values);
+};
+#endif
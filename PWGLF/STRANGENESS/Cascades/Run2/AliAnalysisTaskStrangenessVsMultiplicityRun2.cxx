@@ -1119,6 +1119,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     Int_t nv0s = 0;
     nv0s = lESDevent->GetNumberOfV0s();
 
+    //Columnar table of the V0 candidates of this event
+    for(Int_t icol=0; icol<kV0NColumns; icol++) fV0Table[icol].clear();
+
     for (Int_t iV0 = 0; iV0 < nv0s; iV0++) //extra-crazy test
     {   // This is the begining of the V0 loop
         AliESDv0 *v0 = ((AliESDEvent*)lESDevent)->GetV0(iV0);
@@ -1389,123 +1392,14 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurations = fListV0->GetEntries();
-        //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
-            lV0Result = (AliV0Result*) fListV0->At(lcfg);
-            histoout  = lV0Result->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-            }
-
-            if (
-                //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
-
-                //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
-
-                //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
-
-                //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
-
-                //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
-
-                //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
-
-                //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster()
-                 ) &&
-                //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                 )
-                )
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
-            }
-        }
-        //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-        // End Superlight adaptive output mode
-        //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+        //Step 1: Store candidate in columnar table, configurations evaluated after the V0 loop
+        AddV0Candidate( lOnFlyStatus );
 
     }// This is the end of the V0 loop
 
+    //Step 2: Sweep members of the output object TList and fill all of them as appropriate
+    ProcessV0Configurations();
+
     //------------------------------------------------
     // Rerun cascade vertexer!
     //------------------------------------------------
@@ -1539,6 +1433,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     Long_t ncascades = 0;
     ncascades = lESDevent->GetNumberOfCascades();
 
+    //Columnar table of the cascade candidates of this event
+    for(Int_t icol=0; icol<kCascNColumns; icol++) fCascTable[icol].clear();
+
     for (Int_t iXi = 0; iXi < ncascades; iXi++) {
         //------------------------------------------------
         // Initializations
@@ -2126,260 +2023,14 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
-        //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
-            lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
-            histoout  = lCascadeResult->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0; 
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
-
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
-
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
-            
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
-
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                               lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            
-            if (
-                //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
-                //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
-                // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lCascadeResult->GetCutDCACascDaughters() &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
-                // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
-                // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
-                //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
-                //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
-                //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
-                //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
-                
-                //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
-                //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
-                //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster()
-                 )&&
-                
-                //Check 11: Min Track Length if positive
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                 )&&
-                
-                //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )
-                ){
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
-            }
-        }
-        //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-        // End Superlight adaptive output mode
-        //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+        //Step 1: Store candidate in columnar table, configurations evaluated after the cascade loop
+        AddCascadeCandidate( lV0Pt, lV0TotMomentum );
 
     }// end of the Cascade loop (ESD or AOD)
 
+    //Step 2: Sweep members of the output object TList and fill all of them as appropriate
+    ProcessCascadeConfigurations();
+
     // Post output data.
     PostData(1, fListHist    );
     PostData(2, fListV0      );
@@ -2389,6 +2040,448 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
     if( fkSaveCascadeTree ) PostData(6, fTreeCascade );
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddV0Candidate(Int_t lOnFlyStatus)
+{
+    //Append the current V0 candidate (fTreeVariable* values) to the columnar V0 table
+    fV0Table[kV0OnFlyStatus                    ].push_back( lOnFlyStatus );
+    fV0Table[kV0NegEta                         ].push_back( fTreeVariableNegEta );
+    fV0Table[kV0PosEta                         ].push_back( fTreeVariablePosEta );
+    fV0Table[kV0RapK0Short                     ].push_back( fTreeVariableRapK0Short );
+    fV0Table[kV0RapLambda                      ].push_back( fTreeVariableRapLambda );
+    fV0Table[kV0Radius                         ].push_back( fTreeVariableV0Radius );
+    fV0Table[kV0DcaNegToPrimVertex             ].push_back( fTreeVariableDcaNegToPrimVertex );
+    fV0Table[kV0DcaPosToPrimVertex             ].push_back( fTreeVariableDcaPosToPrimVertex );
+    fV0Table[kV0DcaV0Daughters                 ].push_back( fTreeVariableDcaV0Daughters );
+    fV0Table[kV0CosineOfPointingAngle          ].push_back( fTreeVariableV0CosineOfPointingAngle );
+    fV0Table[kV0DistOverTotMom                 ].push_back( fTreeVariableDistOverTotMom );
+    fV0Table[kV0LeastNbrCrossedRows            ].push_back( fTreeVariableLeastNbrCrossedRows );
+    fV0Table[kV0LeastRatioCrossedRowsOverFindable].push_back( fTreeVariableLeastRatioCrossedRowsOverFindable );
+    fV0Table[kV0PosInnerP                      ].push_back( fTreeVariablePosInnerP );
+    fV0Table[kV0NegInnerP                      ].push_back( fTreeVariableNegInnerP );
+    fV0Table[kV0NSigmasPosProton               ].push_back( TMath::Abs(fTreeVariableNSigmasPosProton) );
+    fV0Table[kV0NSigmasPosPion                 ].push_back( TMath::Abs(fTreeVariableNSigmasPosPion) );
+    fV0Table[kV0NSigmasNegProton               ].push_back( TMath::Abs(fTreeVariableNSigmasNegProton) );
+    fV0Table[kV0NSigmasNegPion                 ].push_back( TMath::Abs(fTreeVariableNSigmasNegPion) );
+    fV0Table[kV0PtArmV0                        ].push_back( fTreeVariablePtArmV0 );
+    fV0Table[kV0AbsAlphaV0                     ].push_back( TMath::Abs(fTreeVariableAlphaV0) );
+    fV0Table[kV0ITSRefit                       ].push_back( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+                                                             (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) );
+    fV0Table[kV0MaxChi2PerCluster              ].push_back( fTreeVariableMaxChi2PerCluster );
+    fV0Table[kV0MinTrackLength                 ].push_back( fTreeVariableMinTrackLength );
+    fV0Table[kV0Pt                             ].push_back( fTreeVariablePt );
+    fV0Table[kV0InvMassK0s                     ].push_back( fTreeVariableInvMassK0s );
+    fV0Table[kV0InvMassLambda                  ].push_back( fTreeVariableInvMassLambda );
+    fV0Table[kV0InvMassAntiLambda              ].push_back( fTreeVariableInvMassAntiLambda );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::ProcessV0Configurations()
+{
+    //Evaluate all V0 configurations over the V0 table of this event:
+    //cuts are loaded once per configuration and tested over contiguous columns
+    const Long_t lNCandidates = fV0Table[kV0Pt].size();
+    if( lNCandidates == 0 ) return;
+
+    const Float_t *lCol[kV0NColumns];
+    for(Int_t icol=0; icol<kV0NColumns; icol++) lCol[icol] = &(fV0Table[icol][0]);
+
+    Int_t lNumberOfConfigurations = fListV0->GetEntries();
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        TH3F *histoout = lV0Result->GetHistogram();
+
+        //Columns depending on mass hypothesis
+        const Float_t *lMass = 0x0, *lRap = 0x0, *lNegdEdx = 0x0, *lPosdEdx = 0x0, *lBaryonMomentum = 0x0;
+        Float_t lPDGMass = -1;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
+            lMass    = lCol[kV0InvMassK0s];
+            lRap     = lCol[kV0RapK0Short];
+            lPDGMass = 0.497;
+            lNegdEdx = lCol[kV0NSigmasNegPion];
+            lPosdEdx = lCol[kV0NSigmasPosPion];
+        }
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
+            lMass    = lCol[kV0InvMassLambda];
+            lRap     = lCol[kV0RapLambda];
+            lPDGMass = 1.115683;
+            lNegdEdx = lCol[kV0NSigmasNegPion];
+            lPosdEdx = lCol[kV0NSigmasPosProton];
+            lBaryonMomentum = lCol[kV0PosInnerP];
+        }
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
+            lMass    = lCol[kV0InvMassAntiLambda];
+            lRap     = lCol[kV0RapLambda];
+            lPDGMass = 1.115683;
+            lNegdEdx = lCol[kV0NSigmasNegProton];
+            lPosdEdx = lCol[kV0NSigmasPosPion];
+            lBaryonMomentum = lCol[kV0NegInnerP];
+        }
+        if ( !lMass ) continue;
+
+        //Cut values of this configuration
+        const Float_t  lOnFly          = lV0Result->GetUseOnTheFly();
+        const Double_t lMinEta         = lV0Result->GetCutMinEtaTracks();
+        const Double_t lMaxEta         = lV0Result->GetCutMaxEtaTracks();
+        const Double_t lMinRap         = lV0Result->GetCutMinRapidity();
+        const Double_t lMaxRap         = lV0Result->GetCutMaxRapidity();
+        const Double_t lV0RadiusCut    = lV0Result->GetCutV0Radius();
+        const Double_t lDCANegToPVCut  = lV0Result->GetCutDCANegToPV();
+        const Double_t lDCAPosToPVCut  = lV0Result->GetCutDCAPosToPV();
+        const Double_t lDCAV0DauCut    = lV0Result->GetCutDCAV0Daughters();
+        const Double_t lLifetimeCut    = lV0Result->GetCutProperLifetime();
+        const Double_t lCrossedRowsCut = lV0Result->GetCutLeastNumberOfCrossedRows();
+        const Double_t lRatioCut       = lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable();
+        const Double_t lMinBaryonMom   = lV0Result->GetCutMinBaryonMomentum();
+        const Double_t lTPCdEdxCut     = lV0Result->GetCutTPCdEdx();
+        const Bool_t   lUseArmenteros  = lV0Result->GetCutArmenteros() && lV0Result->GetMassHypothesis() == AliV0Result::kK0Short;
+        const Double_t lArmenterosPar  = lV0Result->GetCutArmenterosParameter();
+        const Bool_t   lUseITSRefit    = lV0Result->GetCutUseITSRefitTracks();
+        const Double_t lMaxChi2Cut     = lV0Result->GetCutMaxChi2PerCluster();
+        const Bool_t   lUseMaxChi2     = !(lMaxChi2Cut>1e+3);
+        const Double_t lMinLengthCut   = lV0Result->GetCutMinTrackLength();
+        const Bool_t   lUseMinLength   = !(lMinLengthCut<0);
+
+        //Setting up: Variable V0 CosPA
+        const Float_t lV0CosPACutConst = lV0Result -> GetCutV0CosPA();
+        const Bool_t  lUseVarV0CosPA   = lV0Result -> GetCutUseVarV0CosPA();
+        Float_t lVarV0CosPApar[5];
+        lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+        lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+        lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+        lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+        lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+
+        for(Long_t i=0; i<lNCandidates; i++){
+            //Check 1: Offline Vertexer; Check 2: Basic Acceptance cuts; Check 3: Topological Variables
+            if( !( lCol[kV0OnFlyStatus][i] == lOnFly &&
+                  lMinEta < lCol[kV0NegEta][i] && lCol[kV0NegEta][i] < lMaxEta &&
+                  lMinEta < lCol[kV0PosEta][i] && lCol[kV0PosEta][i] < lMaxEta &&
+                  lRap[i] > lMinRap && lRap[i] < lMaxRap &&
+                  lCol[kV0Radius][i] > lV0RadiusCut &&
+                  lCol[kV0DcaNegToPrimVertex][i] > lDCANegToPVCut &&
+                  lCol[kV0DcaPosToPrimVertex][i] > lDCAPosToPVCut &&
+                  lCol[kV0DcaV0Daughters][i] < lDCAV0DauCut &&
+                  lCol[kV0DistOverTotMom][i]*lPDGMass < lLifetimeCut &&
+                  lCol[kV0LeastNbrCrossedRows][i] > lCrossedRowsCut &&
+                  lCol[kV0LeastRatioCrossedRowsOverFindable][i] > lRatioCut ) ) continue;
+
+            //Check 4: Minimum momentum of baryon daughter
+            if( lBaryonMomentum && !(lBaryonMomentum[i] > lMinBaryonMom) ) continue;
+
+            //Check 5: TPC dEdx selections
+            if( !(lNegdEdx[i]<lTPCdEdxCut && lPosdEdx[i]<lTPCdEdxCut) ) continue;
+
+            //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+            if( lUseArmenteros && !(lCol[kV0PtArmV0][i]>lArmenterosPar*lCol[kV0AbsAlphaV0][i]) ) continue;
+
+            //Check 7: kITSrefit track selection if requested
+            if( lUseITSRefit && !lCol[kV0ITSRefit][i] ) continue;
+
+            //Check 8: Max Chi2/Clusters if not absurd; Check 9: Min Track Length if positive
+            if( lUseMaxChi2 && !(lCol[kV0MaxChi2PerCluster][i] < lMaxChi2Cut) ) continue;
+            if( lUseMinLength && !(lCol[kV0MinTrackLength][i] > lMinLengthCut) ) continue;
+
+            //Variable V0 CosPA, only used if tighter than the non-variable cut
+            Float_t lV0CosPACut = lV0CosPACutConst;
+            if( lUseVarV0CosPA ){
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*lCol[kV0Pt][i]) +
+                                                 lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*lCol[kV0Pt][i]) +
+                                                 lVarV0CosPApar[4]);
+                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+            }
+            if( !(lCol[kV0CosineOfPointingAngle][i] > lV0CosPACut) ) continue;
+
+            //This satisfies all my conditionals! Fill histogram
+            histoout -> Fill ( fCentrality, lCol[kV0Pt][i], lMass[i] );
+        }
+    }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddCascadeCandidate(Float_t lV0Pt, Float_t lV0TotMomentum)
+{
+    //Append the current cascade candidate (fTreeCascVar* values) to the columnar cascade table
+    //Candidate-only quantities of the selections are computed here once
+
+    //For parametric V0 Mass selection
+    Float_t lExpV0Mass =
+    fLambdaMassMean[0]+
+    fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+    fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+
+    Float_t lExpV0Sigma =
+    fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+    fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+
+    //For 2.76TeV-like parametric V0 CosPA
+    Float_t l276TeVV0CosPA = 0.998;
+    Float_t pThr=1.5;
+    if (lV0TotMomentum<pThr) {
+        //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+        const Double_t bend=0.03; // approximate Xi bending angle
+        const Double_t qt=0.211;  // max Lambda pT in Omega decay
+        const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+        Double_t
+        cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+        l276TeVV0CosPA = cpaCut;
+    }
+
+    fCascTable[kCascCharge               ].push_back( fTreeCascVarCharge );
+    fCascTable[kCascPosEta               ].push_back( fTreeCascVarPosEta );
+    fCascTable[kCascNegEta               ].push_back( fTreeCascVarNegEta );
+    fCascTable[kCascBachEta              ].push_back( fTreeCascVarBachEta );
+    fCascTable[kCascRapXi                ].push_back( fTreeCascVarRapXi );
+    fCascTable[kCascRapOmega             ].push_back( fTreeCascVarRapOmega );
+    fCascTable[kCascDCANegToPrimVtx      ].push_back( fTreeCascVarDCANegToPrimVtx );
+    fCascTable[kCascDCAPosToPrimVtx      ].push_back( fTreeCascVarDCAPosToPrimVtx );
+    fCascTable[kCascDCAV0Daughters       ].push_back( fTreeCascVarDCAV0Daughters );
+    fCascTable[kCascV0CosPointingAngle   ].push_back( fTreeCascVarV0CosPointingAngle );
+    fCascTable[kCascV0Radius             ].push_back( fTreeCascVarV0Radius );
+    fCascTable[kCascDCAV0ToPrimVtx       ].push_back( fTreeCascVarDCAV0ToPrimVtx );
+    fCascTable[kCascV0MassLambda         ].push_back( fTreeCascVarV0MassLambda );
+    fCascTable[kCascV0MassAntiLambda     ].push_back( fTreeCascVarV0MassAntiLambda );
+    fCascTable[kCascDCABachToPrimVtx     ].push_back( fTreeCascVarDCABachToPrimVtx );
+    fCascTable[kCascDCACascDaughters     ].push_back( fTreeCascVarDCACascDaughters );
+    fCascTable[kCascCascCosPointingAngle ].push_back( fTreeCascVarCascCosPointingAngle );
+    fCascTable[kCascCascRadius           ].push_back( fTreeCascVarCascRadius );
+    fCascTable[kCascExpV0Mass            ].push_back( lExpV0Mass );
+    fCascTable[kCascExpV0Sigma           ].push_back( lExpV0Sigma );
+    fCascTable[kCascDistOverTotMom       ].push_back( fTreeCascVarDistOverTotMom );
+    fCascTable[kCascLeastNbrClusters     ].push_back( fTreeCascVarLeastNbrClusters );
+    fCascTable[kCascNegNSigmaPion        ].push_back( TMath::Abs(fTreeCascVarNegNSigmaPion) );
+    fCascTable[kCascNegNSigmaProton      ].push_back( TMath::Abs(fTreeCascVarNegNSigmaProton) );
+    fCascTable[kCascPosNSigmaPion        ].push_back( TMath::Abs(fTreeCascVarPosNSigmaPion) );
+    fCascTable[kCascPosNSigmaProton      ].push_back( TMath::Abs(fTreeCascVarPosNSigmaProton) );
+    fCascTable[kCascBachNSigmaPion       ].push_back( TMath::Abs(fTreeCascVarBachNSigmaPion) );
+    fCascTable[kCascBachNSigmaKaon       ].push_back( TMath::Abs(fTreeCascVarBachNSigmaKaon) );
+    fCascTable[kCascMassAsXi             ].push_back( fTreeCascVarMassAsXi );
+    fCascTable[kCascMassAsOmega          ].push_back( fTreeCascVarMassAsOmega );
+    fCascTable[kCascDCABachToBaryon      ].push_back( fTreeCascVarDCABachToBaryon );
+    fCascTable[kCascWrongCosPA           ].push_back( fTreeCascVarWrongCosPA );
+    fCascTable[kCascV0Lifetime           ].push_back( fTreeCascVarV0Lifetime );
+    fCascTable[kCascITSRefit             ].push_back( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+                                                      (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+                                                      (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit) );
+    fCascTable[kCascMaxChi2PerCluster    ].push_back( fTreeCascVarMaxChi2PerCluster );
+    fCascTable[kCascMinTrackLength       ].push_back( fTreeCascVarMinTrackLength );
+    fCascTable[kCasc276TeVV0CosPA        ].push_back( l276TeVV0CosPA );
+    fCascTable[kCascPt                   ].push_back( fTreeCascVarPt );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::ProcessCascadeConfigurations()
+{
+    //Evaluate all cascade configurations over the cascade table of this event:
+    //cuts are loaded once per configuration and tested over contiguous columns
+    const Long_t lNCandidates = fCascTable[kCascPt].size();
+    if( lNCandidates == 0 ) return;
+
+    const Float_t *lCol[kCascNColumns];
+    for(Int_t icol=0; icol<kCascNColumns; icol++) lCol[icol] = &(fCascTable[icol][0]);
+
+    Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        TH3F *histoout = lCascadeResult->GetHistogram();
+
+        //Columns depending on mass hypothesis
+        const Float_t *lMass = 0x0, *lV0Mass = 0x0, *lRap = 0x0, *lNegdEdx = 0x0, *lPosdEdx = 0x0, *lBachdEdx = 0x0;
+        Float_t lPDGMass = -1;
+        Short_t lCharge  = -2;
+        Bool_t  lIsOmega = kFALSE;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
+            lCharge  = -1;
+            lMass    = lCol[kCascMassAsXi];
+            lV0Mass  = lCol[kCascV0MassLambda];
+            lRap     = lCol[kCascRapXi];
+            lPDGMass = 1.32171;
+            lNegdEdx = lCol[kCascNegNSigmaPion];
+            lPosdEdx = lCol[kCascPosNSigmaProton];
+            lBachdEdx= lCol[kCascBachNSigmaPion];
+        }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
+            lCharge  = +1;
+            lMass    = lCol[kCascMassAsXi];
+            lV0Mass  = lCol[kCascV0MassAntiLambda];
+            lRap     = lCol[kCascRapXi];
+            lPDGMass = 1.32171;
+            lNegdEdx = lCol[kCascNegNSigmaProton];
+            lPosdEdx = lCol[kCascPosNSigmaPion];
+            lBachdEdx= lCol[kCascBachNSigmaPion];
+        }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
+            lCharge  = -1;
+            lMass    = lCol[kCascMassAsOmega];
+            lV0Mass  = lCol[kCascV0MassLambda];
+            lRap     = lCol[kCascRapOmega];
+            lPDGMass = 1.67245;
+            lNegdEdx = lCol[kCascNegNSigmaPion];
+            lPosdEdx = lCol[kCascPosNSigmaProton];
+            lBachdEdx= lCol[kCascBachNSigmaKaon];
+            lIsOmega = kTRUE;
+        }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
+            lCharge  = +1;
+            lMass    = lCol[kCascMassAsOmega];
+            lV0Mass  = lCol[kCascV0MassAntiLambda];
+            lRap     = lCol[kCascRapOmega];
+            lPDGMass = 1.67245;
+            lNegdEdx = lCol[kCascNegNSigmaProton];
+            lPosdEdx = lCol[kCascPosNSigmaPion];
+            lBachdEdx= lCol[kCascBachNSigmaKaon];
+            lIsOmega = kTRUE;
+        }
+        if ( !lMass ) continue;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+
+        //Cut values of this configuration
+        const Double_t lMinEta          = lCascadeResult->GetCutMinEtaTracks();
+        const Double_t lMaxEta          = lCascadeResult->GetCutMaxEtaTracks();
+        const Double_t lMinRap          = lCascadeResult->GetCutMinRapidity();
+        const Double_t lMaxRap          = lCascadeResult->GetCutMaxRapidity();
+        const Double_t lDCANegToPVCut   = lCascadeResult->GetCutDCANegToPV();
+        const Double_t lDCAPosToPVCut   = lCascadeResult->GetCutDCAPosToPV();
+        const Double_t lDCAV0DauCut     = lCascadeResult->GetCutDCAV0Daughters();
+        const Double_t lV0RadiusCut     = lCascadeResult->GetCutV0Radius();
+        const Double_t lDCAV0ToPVCut    = lCascadeResult->GetCutDCAV0ToPV();
+        const Double_t lV0MassCut       = lCascadeResult->GetCutV0Mass();
+        const Double_t lDCABachToPVCut  = lCascadeResult->GetCutDCABachToPV();
+        const Double_t lDCACascDauCut   = lCascadeResult->GetCutDCACascDaughters();
+        const Double_t lCascRadiusCut   = lCascadeResult->GetCutCascRadius();
+        const Double_t lV0MassSigmaCut  = lCascadeResult->GetCutV0MassSigma();
+        const Bool_t   lUseV0MassSigma  = !(lV0MassSigmaCut > 50);
+        const Double_t lLifetimeCut     = lCascadeResult->GetCutProperLifetime();
+        const Double_t lClustersCut     = lCascadeResult->GetCutLeastNumberOfClusters();
+        const Double_t lTPCdEdxCut      = lCascadeResult->GetCutTPCdEdx();
+        const Double_t lXiRejectionCut  = lCascadeResult->GetCutXiRejection();
+        const Double_t lDCABachBarCut   = lCascadeResult->GetCutDCABachToBaryon();
+        const Double_t lMinV0Lifetime   = lCascadeResult->GetCutMinV0Lifetime();
+        const Double_t lMaxV0Lifetime   = lCascadeResult->GetCutMaxV0Lifetime();
+        const Bool_t   lUseMaxV0Lifetime= !(lMaxV0Lifetime > 1e+3);
+        const Bool_t   lUseITSRefit     = lCascadeResult->GetCutUseITSRefitTracks();
+        const Double_t lMaxChi2Cut      = lCascadeResult->GetCutMaxChi2PerCluster();
+        const Bool_t   lUseMaxChi2      = !(lMaxChi2Cut>1e+3);
+        const Double_t lMinLengthCut    = lCascadeResult->GetCutMinTrackLength();
+        const Bool_t   lUseMinLength    = !(lMinLengthCut<0);
+        const Bool_t   lUse276TeVV0CosPA= lCascadeResult->GetCutUse276TeVV0CosPA();
+
+        //Setting up: Variable Cascade, V0 and BB CosPA
+        const Float_t lCascCosPACutConst = lCascadeResult -> GetCutCascCosPA();
+        const Bool_t  lUseVarCascCosPA   = lCascadeResult -> GetCutUseVarCascCosPA();
+        Float_t lVarCascCosPApar[5];
+        lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+        lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+        lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+        lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+        lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+
+        const Float_t lV0CosPACutConst = lCascadeResult -> GetCutV0CosPA();
+        const Bool_t  lUseVarV0CosPA   = lCascadeResult -> GetCutUseVarV0CosPA();
+        Float_t lVarV0CosPApar[5];
+        lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+        lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+        lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+        lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+        lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+
+        const Float_t lBBCosPACutConst = lCascadeResult -> GetCutBachBaryonCosPA();
+        const Bool_t  lUseVarBBCosPA   = lCascadeResult -> GetCutUseVarBBCosPA();
+        Float_t lVarBBCosPApar[5];
+        lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+        lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+        lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+        lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+        lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+
+        for(Long_t i=0; i<lNCandidates; i++){
+            //Check 1: Charge consistent with expectations; Check 2: Basic Acceptance cuts; Check 3: Topological Variables
+            if( !( lCol[kCascCharge][i] == lCharge &&
+                  lMinEta < lCol[kCascPosEta][i] && lCol[kCascPosEta][i] < lMaxEta &&
+                  lMinEta < lCol[kCascNegEta][i] && lCol[kCascNegEta][i] < lMaxEta &&
+                  lMinEta < lCol[kCascBachEta][i] && lCol[kCascBachEta][i] < lMaxEta &&
+                  lRap[i] > lMinRap && lRap[i] < lMaxRap &&
+                  lCol[kCascDCANegToPrimVtx][i] > lDCANegToPVCut &&
+                  lCol[kCascDCAPosToPrimVtx][i] > lDCAPosToPVCut &&
+                  lCol[kCascDCAV0Daughters][i] < lDCAV0DauCut &&
+                  lCol[kCascV0Radius][i] > lV0RadiusCut &&
+                  lCol[kCascDCAV0ToPrimVtx][i] > lDCAV0ToPVCut &&
+                  TMath::Abs(lV0Mass[i]-1.116) < lV0MassCut &&
+                  lCol[kCascDCABachToPrimVtx][i] > lDCABachToPVCut &&
+                  lCol[kCascDCACascDaughters][i] < lDCACascDauCut &&
+                  lCol[kCascCascRadius][i] > lCascRadiusCut &&
+                  lCol[kCascDistOverTotMom][i]*lPDGMass < lLifetimeCut &&
+                  lCol[kCascLeastNbrClusters][i] > lClustersCut ) ) continue;
+
+            //Parametric V0 Mass cut if requested
+            if( lUseV0MassSigma && !(TMath::Abs( (lV0Mass[i]-lCol[kCascExpV0Mass][i]) / lCol[kCascExpV0Sigma][i] ) < lV0MassSigmaCut) ) continue;
+
+            //Check 4: TPC dEdx selections
+            if( !(lNegdEdx[i]<lTPCdEdxCut && lPosdEdx[i]<lTPCdEdxCut && lBachdEdx[i]<lTPCdEdxCut) ) continue;
+
+            //Check 5: Xi rejection for Omega analysis
+            if( lIsOmega && !(TMath::Abs( lCol[kCascMassAsXi][i] - 1.32171 ) > lXiRejectionCut) ) continue;
+
+            //Check 6: Experimental DCA Bachelor to Baryon cut
+            if( !(lCol[kCascDCABachToBaryon][i] > lDCABachBarCut) ) continue;
+
+            //Check 8: Min/Max V0 Lifetime cut
+            if( !(lCol[kCascV0Lifetime][i] > lMinV0Lifetime) ) continue;
+            if( lUseMaxV0Lifetime && !(lCol[kCascV0Lifetime][i] < lMaxV0Lifetime) ) continue;
+
+            //Check 9: kITSrefit track selection if requested
+            if( lUseITSRefit && !lCol[kCascITSRefit][i] ) continue;
+
+            //Check 10: Max Chi2/Clusters if not absurd; Check 11: Min Track Length if positive
+            if( lUseMaxChi2 && !(lCol[kCascMaxChi2PerCluster][i] < lMaxChi2Cut) ) continue;
+            if( lUseMinLength && !(lCol[kCascMinTrackLength][i] > lMinLengthCut) ) continue;
+
+            //Check 12: Check if special V0 CosPA cut used
+            if( lUse276TeVV0CosPA && !(lCol[kCascV0CosPointingAngle][i]>lCol[kCasc276TeVV0CosPA][i]) ) continue;
+
+            //Variable CosPA cuts
+            const Float_t lPt = lCol[kCascPt][i];
+            Float_t lV0CosPACut = lV0CosPACutConst;
+            if( lUseVarV0CosPA ){
+                //Only use if tighter than the non-variable cut
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*lPt) +
+                                                 lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*lPt) +
+                                                 lVarV0CosPApar[4]);
+                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+            }
+            if( !(lCol[kCascV0CosPointingAngle][i] > lV0CosPACut) ) continue;
+
+            Float_t lCascCosPACut = lCascCosPACutConst;
+            if( lUseVarCascCosPA ){
+                //Only use if tighter than the non-variable cut
+                Float_t lVarCascCosPA = TMath::Cos(
+                                                   lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*lPt) +
+                                                   lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*lPt) +
+                                                   lVarCascCosPApar[4]);
+                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
+            }
+            if( !(lCol[kCascCascCosPointingAngle][i] > lCascCosPACut) ) continue;
+
+            //Check 7: Experimental Bach Baryon CosPA
+            Float_t lBBCosPACut = lBBCosPACutConst;
+            if( lUseVarBBCosPA ){
+                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+                Float_t lVarBBCosPA = TMath::Cos(
+                                                 lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*lPt) +
+                                                 lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*lPt) +
+                                                 lVarBBCosPApar[4]);
+                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
+            }
+            if( !(lCol[kCascWrongCosPA][i] < lBBCosPACut) ) continue;
+
+            //This satisfies all my conditionals! Fill histogram
+            histoout -> Fill ( fCentrality, lPt, lMass[i] );
+        }
+    }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::Terminate(Option_t *)
 {
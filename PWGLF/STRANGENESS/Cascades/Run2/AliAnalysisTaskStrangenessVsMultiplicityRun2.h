@@ -470,11 +470,48 @@ private:
     TH1D *fHistEventCounter; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Superlight mode: columnar candidate tables
+//===========================================================================================
+    //Candidates of the event are stored column-wise and all configurations
+    //are evaluated over them after the V0 / cascade loop
+    enum EV0Column {
+        kV0OnFlyStatus=0, kV0NegEta, kV0PosEta, kV0RapK0Short, kV0RapLambda,
+        kV0Radius, kV0DcaNegToPrimVertex, kV0DcaPosToPrimVertex, kV0DcaV0Daughters,
+        kV0CosineOfPointingAngle, kV0DistOverTotMom, kV0LeastNbrCrossedRows,
+        kV0LeastRatioCrossedRowsOverFindable, kV0PosInnerP, kV0NegInnerP,
+        kV0NSigmasPosProton, kV0NSigmasPosPion, kV0NSigmasNegProton, kV0NSigmasNegPion,
+        kV0PtArmV0, kV0AbsAlphaV0, kV0ITSRefit, kV0MaxChi2PerCluster, kV0MinTrackLength,
+        kV0Pt, kV0InvMassK0s, kV0InvMassLambda, kV0InvMassAntiLambda,
+        kV0NColumns
+    };
+    enum ECascColumn {
+        kCascCharge=0, kCascPosEta, kCascNegEta, kCascBachEta, kCascRapXi, kCascRapOmega,
+        kCascDCANegToPrimVtx, kCascDCAPosToPrimVtx, kCascDCAV0Daughters,
+        kCascV0CosPointingAngle, kCascV0Radius, kCascDCAV0ToPrimVtx,
+        kCascV0MassLambda, kCascV0MassAntiLambda, kCascDCABachToPrimVtx,
+        kCascDCACascDaughters, kCascCascCosPointingAngle, kCascCascRadius,
+        kCascExpV0Mass, kCascExpV0Sigma, kCascDistOverTotMom, kCascLeastNbrClusters,
+        kCascNegNSigmaPion, kCascNegNSigmaProton, kCascPosNSigmaPion, kCascPosNSigmaProton,
+        kCascBachNSigmaPion, kCascBachNSigmaKaon, kCascMassAsXi, kCascMassAsOmega,
+        kCascDCABachToBaryon, kCascWrongCosPA, kCascV0Lifetime, kCascITSRefit,
+        kCascMaxChi2PerCluster, kCascMinTrackLength, kCasc276TeVV0CosPA, kCascPt,
+        kCascNColumns
+    };
+    std::vector<Float_t> fV0Table[kV0NColumns];     //! V0 candidates of the event, per column
+    std::vector<Float_t> fCascTable[kCascNColumns]; //! Cascade candidates of the event, per column
+
+    void AddV0Candidate( Int_t lOnFlyStatus );
+    void ProcessV0Configurations();
+    void AddCascadeCandidate( Float_t lV0Pt, Float_t lV0TotMomentum );
+    void ProcessCascadeConfigurations();
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 2);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 3);
     //1: first implementation
+    //3: columnar candidate tables for superlight mode
 };
 
 #endif
@@ -53,6 +53,7 @@ class AliAODv0;
 #include "TLegend.h"
 #include "TRandom3.h"
 #include "TLorentzVector.h"
+#include "TArrayD.h"
 //#include "AliLog.h"
 
 #include "AliESDEvent.h"
@@ -96,6 +97,8 @@ using std::endl;
 
 ClassImp(AliAnalysisTaskWeakDecayVertexer)
 
+const Double_t AliAnalysisTaskWeakDecayVertexer::fgkPreFilterTolerance = 1.e-4; //cm, rounding safety of the pre-filter
+
 AliAnalysisTaskWeakDecayVertexer::AliAnalysisTaskWeakDecayVertexer()
     : AliAnalysisTaskSE(), fListHist(0), fPIDResponse(0),
 //________________________________________________
@@ -113,6 +116,7 @@ fkExtraCleanup    ( kTRUE ), //extra cleanup: eta, etc
 //Flags for V0 vertexer
 fkRunV0Vertexer (kFALSE),
 fkDoV0Refit       ( kFALSE ),
+fkUseGeometricPreFilter ( kFALSE ),
 //________________________________________________
 //Flags for cascade vertexer
 fkRunCascadeVertexer    ( kFALSE ),
@@ -152,6 +156,7 @@ fkExtraCleanup    ( kTRUE ), //extra cleanup: eta, etc
 //Flags for V0 vertexer
 fkRunV0Vertexer (kFALSE),
 fkDoV0Refit       ( kFALSE ),
+fkUseGeometricPreFilter ( kFALSE ),
 //________________________________________________
 //Flags for cascade vertexer
 fkRunCascadeVertexer    ( kFALSE ),
@@ -515,12 +520,24 @@ Long_t AliAnalysisTaskWeakDecayVertexer::Tracks2V0vertices(AliESDEvent *event) {
         else pos[npos++]=i;
     }
     
+    //Transverse projections of the selected tracks for the geometric pre-filter
+    TArrayD negCircle, posCircle;
+    if (fkUseGeometricPreFilter) {
+        negCircle.Set(5*nneg);
+        posCircle.Set(5*npos);
+        for (i=0; i<nneg; i++) GetTransverseCircle(event->GetTrack(neg[i]),b,negCircle.GetArray()+5*i);
+        for (i=0; i<npos; i++) GetTransverseCircle(event->GetTrack(pos[i]),b,posCircle.GetArray()+5*i);
+    }
     
     for (i=0; i<nneg; i++) {
         Long_t nidx=neg[i];
         AliESDtrack *ntrk=event->GetTrack(nidx);
         
         for (Int_t k=0; k<npos; k++) {
+            //Geometric pre-filter: helices too far apart to pass the DCA cut
+            if (fkUseGeometricPreFilter &&
+                CirclesTooFar(negCircle.GetArray()+5*i,posCircle.GetArray()+5*k,fV0VertexerSels[3])) continue;
+            
             Int_t pidx=pos[k];
             AliESDtrack *ptrk=event->GetTrack(pidx);
             
@@ -702,6 +719,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
     // stores relevant tracks in another array
     Long_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Long_t ntr=0;
+    
+    //Geometric pre-filter only safe with the improved finding (DCA to a point of the helix)
+    Bool_t lUsePreFilter = fkUseGeometricPreFilter && fkDoImprovedCascadeVertexFinding;
+    TArrayD bachCircle; if (lUsePreFilter) bachCircle.Set(5*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         ULong_t status=esdtr->GetStatus();
@@ -715,6 +736,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         if (esdtr->GetTPCNcls() < 70 && lThisTrackLength<80 ) continue;
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
+        if (lUsePreFilter) GetTransverseCircle(esdtr,b,bachCircle.GetArray()+5*ntr);
         trk[ntr++]=i;
     }
     
@@ -727,7 +749,11 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0); // the v0 must be Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0Line[4]; GetTransverseLine(&v0,lV0Line);
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
+            //Geometric pre-filter: bachelor helix too far from the V0 line to pass the DCA cut
+            if (lUsePreFilter && LineTooFar(bachCircle.GetArray()+5*j,lV0Line,fCascadeVertexerSels[4])) continue;
+            
             Int_t bidx=trk[j];
             //Bo:   if (bidx==v->GetNindex()) continue; //bachelor and v0's negative tracks must be different
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
@@ -785,8 +811,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVertices(AliESDEvent *
         AliESDv0 v0(*v);
         v0.ChangeMassHypothesis(kLambda0Bar); //the v0 must be anti-Lambda
         if (TMath::Abs(v0.GetEffMass()-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0Line[4]; GetTransverseLine(&v0,lV0Line);
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
+            //Geometric pre-filter: bachelor helix too far from the V0 line to pass the DCA cut
+            if (lUsePreFilter && LineTooFar(bachCircle.GetArray()+5*j,lV0Line,fCascadeVertexerSels[4])) continue;
+            
             Int_t bidx=trk[j];
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 1 for pos
             
@@ -971,6 +1001,10 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
     // stores candidate bachelor tracks in another array
     Int_t nentr=(Int_t)event->GetNumberOfTracks();
     TArrayI trk(nentr); Int_t ntr=0;
+    
+    //Geometric pre-filter only safe with the improved finding (DCA to a point of the helix)
+    Bool_t lUsePreFilter = fkUseGeometricPreFilter && fkDoImprovedCascadeVertexFinding;
+    TArrayD bachCircle; if (lUsePreFilter) bachCircle.Set(5*nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         
@@ -986,6 +1020,7 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fCascadeVertexerSels[3]) continue;
         
+        if (lUsePreFilter) GetTransverseCircle(esdtr,b,bachCircle.GetArray()+5*ntr);
         trk[ntr++]=i;
     }
     
@@ -1011,8 +1046,12 @@ Long_t AliAnalysisTaskWeakDecayVertexer::V0sTracks2CascadeVerticesUncheckedCharg
         //Only disregard if it does not pass any of the desired hypotheses
         if (TMath::Abs(lMassAsLambda-massLambda)>fCascadeVertexerSels[2] &&
             TMath::Abs(lMassAsAntiLambda-massLambda)>fCascadeVertexerSels[2]) continue;
+        Double_t lV0Line[4]; GetTransverseLine(&v0,lV0Line);
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
+            //Geometric pre-filter: bachelor helix too far from the V0 line to pass the DCA cut
+            if (lUsePreFilter && LineTooFar(bachCircle.GetArray()+5*j,lV0Line,fCascadeVertexerSels[4])) continue;
+            
             Int_t bidx=trk[j];
             //Check if different tracks are used all times
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
@@ -1297,6 +1336,73 @@ void AliAnalysisTaskWeakDecayVertexer::Evaluate(const Double_t *h, Double_t t,
     gg[0]=-h[4]*sn; gg[1]=h[4]*cs; gg[2]=0.;
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetTransverseCircle(const AliExternalTrackParam *t, Double_t b, Double_t *c) const {
+    //--------------------------------------------------------------------
+    // This function stores the transverse projection of the track helix:
+    // c[0],c[1] centre, c[2] radius (negative if straight), and the
+    // position uncertainties c[3]=sigmaY2, c[4]=sigmaZ2 used in GetDCA
+    //--------------------------------------------------------------------
+    Double_t h[6]; t->GetHelixParameters(h,b);
+    c[0]=c[1]=0.; c[2]=-1.;
+    if (TMath::Abs(h[4])>kAlmost0) {
+        c[0]=h[5] - TMath::Sin(h[2])/h[4];
+        c[1]=h[0] + TMath::Cos(h[2])/h[4];
+        c[2]=1./TMath::Abs(h[4]);
+    }
+    c[3]=t->GetSigmaY2();
+    c[4]=t->GetSigmaZ2();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskWeakDecayVertexer::GetTransverseLine(AliESDv0 *v, Double_t *l) const {
+    //--------------------------------------------------------------------
+    // This function stores the transverse projection of the V0 line:
+    // l[0],l[1] decay point, l[2],l[3] momentum direction
+    //--------------------------------------------------------------------
+    Double_t x,y,z,px,py,pz;
+    v->GetXYZ(x,y,z);
+    v->GetPxPyPz(px,py,pz);
+    l[0]=x; l[1]=y; l[2]=px; l[3]=py;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::CirclesTooFar(const Double_t *c1, const Double_t *c2, Double_t dcamax) const {
+    //--------------------------------------------------------------------
+    // Geometric pre-filter for the V0 finding: returns kTRUE if the DCA
+    // between the two helices (as returned by AliExternalTrackParam::GetDCA)
+    // is larger than dcamax. The distance between the transverse circles
+    // is a lower bound of the DCA, weighted as in GetDCA:
+    //   dca^2 >= d^2 * sqrt(sigmaZ2/sigmaY2)
+    //--------------------------------------------------------------------
+    if (c1[2]<0 || c2[2]<0) return kFALSE;
+    Double_t dy2=c1[3]+c2[3], dz2=c1[4]+c2[4];
+    if (dy2<=0 || dz2<=0) return kFALSE;
+    
+    Double_t dx=c1[0]-c2[0], dy=c1[1]-c2[1];
+    Double_t d=TMath::Sqrt(dx*dx+dy*dy);
+    Double_t dt=TMath::Max(d-c1[2]-c2[2],TMath::Abs(c1[2]-c2[2])-d); //<0 if circles cross
+    if (dt<=0) return kFALSE;
+    
+    return dt*TMath::Sqrt(TMath::Sqrt(dz2/dy2)) > dcamax+fgkPreFilterTolerance;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskWeakDecayVertexer::LineTooFar(const Double_t *c, const Double_t *l, Double_t dcamax) const {
+    //--------------------------------------------------------------------
+    // Geometric pre-filter for the cascade finding: returns kTRUE if the
+    // bachelor helix (transverse circle c) cannot come closer than dcamax
+    // to the V0 line l. Valid for the improved cascade vertex finding,
+    // where the DCA is measured from a point of the bachelor helix
+    //--------------------------------------------------------------------
+    if (c[2]<0) return kFALSE;
+    Double_t pt=TMath::Sqrt(l[2]*l[2]+l[3]*l[3]);
+    if (pt<kAlmost0) return kFALSE;
+    
+    Double_t h=TMath::Abs((c[0]-l[0])*l[3] - (c[1]-l[1])*l[2])/pt; //centre to line
+    return h-c[2] > dcamax+fgkPreFilterTolerance;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskWeakDecayVertexer::CheckChargeV0(AliESDv0 *v0)
 {
@@ -89,6 +89,12 @@ public:
     void SetExtraCleanup ( Bool_t lExtraCleanup = kTRUE) {
         fkExtraCleanup = lExtraCleanup;
     }
+    void SetUseGeometricPreFilter ( Bool_t lOpt = kTRUE) {
+        //Reject track pairs (V0) and V0-bachelor pairs (cascades, improved finding only)
+        //whose transverse projections are too far apart to pass the DCA selection,
+        //before any propagation. Candidates found are unchanged.
+        fkUseGeometricPreFilter = lOpt;
+    }
 //---------------------------------------------------------------------------------------
     void SetUseExtraEvSels ( Bool_t lUseExtraEvSels = kTRUE) {
         fkDoExtraEvSels = lUseExtraEvSels;
@@ -179,6 +185,11 @@ public:
                   Double_t g[3],  //first defivatives
                   Double_t gg[3]); //second derivatives
     void CheckChargeV0(AliESDv0 *v0);
+    //Geometric pre-filter helpers
+    void GetTransverseCircle(const AliExternalTrackParam *t, Double_t b, Double_t *c) const;
+    void GetTransverseLine(AliESDv0 *v, Double_t *l) const;
+    Bool_t CirclesTooFar(const Double_t *c1, const Double_t *c2, Double_t dcamax) const;
+    Bool_t LineTooFar(const Double_t *c, const Double_t *l, Double_t dcamax) const;
     //---------------------------------------------------------------------------------------
 
 private:
@@ -207,6 +218,9 @@ private:
     Bool_t    fkUseUncheckedChargeCascadeVertexer; //if true, use cascade vertexer that does not check bachelor charge
     Bool_t    fkDoV0Refit;              // if true, will invoke AliESDv0::Refit in the vertexing procedure
     Bool_t    fkExtraCleanup;           //if true, perform pre-rejection of useless candidates before going through configs
+    Bool_t    fkUseGeometricPreFilter;  //if true, reject pairs from their transverse projections before propagation
+
+    static const Double_t fgkPreFilterTolerance; //safety margin of the geometric pre-filter (cm)
 
     AliVEvent::EOfflineTriggerTypes fTrigType; // trigger type
 
@@ -237,8 +251,9 @@ private:
     AliAnalysisTaskWeakDecayVertexer(const AliAnalysisTaskWeakDecayVertexer&);            // not implemented
     AliAnalysisTaskWeakDecayVertexer& operator=(const AliAnalysisTaskWeakDecayVertexer&); // not implemented
 
-    ClassDef(AliAnalysisTaskWeakDecayVertexer, 1);
+    ClassDef(AliAnalysisTaskWeakDecayVertexer, 2);
     //1: first implementation
+    //2: geometric pre-filter
 };
 
 #endif
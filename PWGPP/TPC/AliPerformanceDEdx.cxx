@@ -288,19 +288,23 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
   objArrayList = new TObjArray();
 
   // collection of generated histograms
+  TObjArray deDxHistoList;
   Int_t count=0;
   while((obj = iter->Next()) != 0) 
   {
     AliPerformanceDEdx* entry = dynamic_cast<AliPerformanceDEdx*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fDeDxHisto) && (entry->fDeDxHisto)) { fDeDxHisto->Add(entry->fDeDxHisto); }        
+        if (entry->fDeDxHisto) { deDxHistoList.Add(entry->fDeDxHisto); }        
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    if (fDeDxHisto) { MergeTHnSparse(fDeDxHisto, &deDxHistoList); }
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fDeDxHisto->Reset(); }
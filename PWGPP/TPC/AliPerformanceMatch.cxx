@@ -669,23 +669,33 @@ Long64_t AliPerformanceMatch::Merge(TCollection* const list)
   objArrayList = new TObjArray();
 
   // collection of generated histograms
+  TObjArray resolHistoList;
+  TObjArray pullHistoList;
+  TObjArray trackingEffHistoList;
+  TObjArray constrainHistoList;
   Int_t count=0;
   while((obj = iter->Next()) != 0) 
   {
     AliPerformanceMatch* entry = dynamic_cast<AliPerformanceMatch*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fResolHisto) && (entry->fResolHisto)) { fResolHisto->Add(entry->fResolHisto); }
-        if ((fPullHisto) && (entry->fPullHisto)) { fPullHisto->Add(entry->fPullHisto); }
-        if ((fTrackingEffHisto) && (entry->fTrackingEffHisto)) { fTrackingEffHisto->Add(entry->fTrackingEffHisto); }
+        if (entry->fResolHisto) { resolHistoList.Add(entry->fResolHisto); }
+        if (entry->fPullHisto) { pullHistoList.Add(entry->fPullHisto); }
+        if (entry->fTrackingEffHisto) { trackingEffHistoList.Add(entry->fTrackingEffHisto); }
 
-        if ((fTPCConstrain) && (entry->fTPCConstrain)) { fTPCConstrain->Add(entry->fTPCConstrain); }
+        if (entry->fTPCConstrain) { constrainHistoList.Add(entry->fTPCConstrain); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    if (fResolHisto) { MergeTHnSparse(fResolHisto, &resolHistoList); }
+    if (fPullHisto) { MergeTHnSparse(fPullHisto, &pullHistoList); }
+    if (fTrackingEffHisto) { MergeTHnSparse(fTrackingEffHisto, &trackingEffHistoList); }
+    if (fTPCConstrain) { MergeTHnSparse(fTPCConstrain, &constrainHistoList); }
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fResolHisto->Reset(); fPullHisto->Reset(); fTrackingEffHisto->Reset(); fTPCConstrain->Reset(); }
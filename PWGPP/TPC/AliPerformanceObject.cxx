@@ -22,6 +22,10 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
 
 #include "TCanvas.h"
 #include "TH1.h"
@@ -40,6 +44,8 @@ using namespace std;
 
 ClassImp(AliPerformanceObject)
 
+Bool_t AliPerformanceObject::fgSortedTHnSparseMerge = kFALSE;
+
 //_____________________________________________________________________________
 AliPerformanceObject::AliPerformanceObject():
   TNamed("AliPerformanceObject","AliPerformanceObject"),
@@ -243,3 +249,109 @@ void AliPerformanceObject::AddProjection(TObjArray* aFolderObj, TString nameSpar
   h3->SetTitle(title.Data());  
   aFolderObj->Add(h3);
 }
+
+
+//_____________________________________________________________________________
+void AliPerformanceObject::MergeTHnSparse(THnSparse* target, TObjArray* sources)
+{
+  // Add the THnSparse in sources to target.
+  //
+  // With SetSortedTHnSparseMerge(), the filled bins of each source are 
+  // collected as (global bin index, content, error2), sorted once per source 
+  // and combined by a linear k-way merge. The target is then looked up 
+  // only once per distinct bin, instead of once per filled bin of every source.
+  // The bin contents, errors and number of entries are the same as with 
+  // THnSparse::Add(); the sums of weights used by GetMean()/GetRMS() 
+  // are those of the target only. Sources with a different binning, 
+  // or too many bins for a global index, are added with THnSparse::Add().
+
+  if (!target || !sources) return;
+
+  if (!fgSortedTHnSparseMerge) {
+    for (Int_t i=0; i<sources->GetEntriesFast(); i++) {
+      THnSparse* h = dynamic_cast<THnSparse*>(sources->At(i));
+      if (h) target->Add(h);
+    }
+    return;
+  }
+
+  // strides of the global bin index, including underflow and overflow bins
+  const Int_t ndim = target->GetNdimensions();
+  std::vector<Long64_t> stride(ndim+1,1);
+  Bool_t indexable = kTRUE;
+  for (Int_t d=ndim-1; d>=0; d--) {
+    Long64_t nbins = target->GetAxis(d)->GetNbins()+2;
+    if (stride[d+1] > (Long64_t(1)<<62)/nbins) { indexable = kFALSE; break; }
+    stride[d] = stride[d+1]*nbins;
+  }
+
+  // bins of the compatible sources
+  typedef std::pair<Long64_t, std::pair<Double_t,Double_t> > Bin;
+  std::vector<std::vector<Bin> > bins;
+  Bool_t errors = target->GetCalculateErrors();
+  Double_t entries = 0.;
+  std::vector<Int_t> coord(ndim);
+  for (Int_t i=0; i<sources->GetEntriesFast(); i++) {
+    THnSparse* h = dynamic_cast<THnSparse*>(sources->At(i));
+    if (!h) continue;
+
+    Bool_t compatible = indexable && (h->GetNdimensions() == ndim);
+    for (Int_t d=0; compatible && d<ndim; d++) {
+      const TAxis* a1 = target->GetAxis(d);
+      const TAxis* a2 = h->GetAxis(d);
+      compatible = (a1->GetNbins() == a2->GetNbins() && a1->GetXmin() == a2->GetXmin() && a1->GetXmax() == a2->GetXmax() &&
+                    a1->GetXbins()->GetSize() == a2->GetXbins()->GetSize());
+      for (Int_t b=0; compatible && b<a1->GetXbins()->GetSize(); b++)
+        compatible = (a1->GetXbins()->At(b) == a2->GetXbins()->At(b));
+    }
+    if (!compatible) { target->Add(h); continue; }
+
+    if (h->GetCalculateErrors()) errors = kTRUE;
+    bins.push_back(std::vector<Bin>());
+    std::vector<Bin>& hbins = bins.back();
+    hbins.reserve(h->GetNbins());
+    for (Long64_t ibin=0; ibin<h->GetNbins(); ibin++) {
+      Double_t content = h->GetBinContent(ibin, &coord[0]);
+      Long64_t index = 0;
+      for (Int_t d=0; d<ndim; d++) index += coord[d]*stride[d+1];
+      hbins.push_back(Bin(index, std::make_pair(content, h->GetBinError2(ibin))));
+    }
+    std::sort(hbins.begin(), hbins.end());
+    entries += h->GetEntries();
+  }
+  if (bins.empty()) return;
+
+  // the incompatible sources added above may have switched on the errors of the target
+  errors |= target->GetCalculateErrors();
+  if (errors && !target->GetCalculateErrors()) target->Sumw2();
+  entries += target->GetEntries();
+
+  // k-way merge of the sorted sources, each distinct bin is added once to the target
+  typedef std::pair<Long64_t, Int_t> Head;
+  std::priority_queue<Head, std::vector<Head>, std::greater<Head> > heads;
+  std::vector<size_t> pos(bins.size(),0);
+  size_t nbinsTotal = 0;
+  for (size_t k=0; k<bins.size(); k++) {
+    nbinsTotal += bins[k].size();
+    if (!bins[k].empty()) heads.push(Head(bins[k][0].first, k));
+  }
+  target->Reserve(target->GetNbins()+nbinsTotal);
+
+  while (!heads.empty()) {
+    Long64_t index = heads.top().first;
+    Double_t content = 0.;
+    Double_t error2 = 0.;
+    while (!heads.empty() && heads.top().first == index) {
+      Int_t k = heads.top().second;
+      heads.pop();
+      content += bins[k][pos[k]].second.first;
+      error2 += bins[k][pos[k]].second.second;
+      if (++pos[k] < bins[k].size()) heads.push(Head(bins[k][pos[k]].first, k));
+    }
+    for (Int_t d=0; d<ndim; d++) coord[d] = (index/stride[d+1]) % (stride[d]/stride[d+1]);
+    Long64_t bin = target->GetBin(&coord[0], kTRUE);
+    target->AddBinContent(bin, content);
+    if (errors) target->AddBinError2(bin, error2);
+  }
+  target->SetEntries(entries);
+}
@@ -89,6 +89,10 @@ public :
   // merging of thnsparse
   Bool_t GetMergeTHnSparseObj() { return fMergeTHnSparseObj; }
   void SetMergeTHnSparseObj(Bool_t merge) {fMergeTHnSparseObj = merge; }  
+
+  // merge the THnSparse by a k-way merge of their sorted bins (see MergeTHnSparse)
+  static void SetSortedTHnSparseMerge(Bool_t sorted = kTRUE) { fgSortedTHnSparseMerge = sorted; }
+  static Bool_t GetSortedTHnSparseMerge() { return fgSortedTHnSparseMerge; }
   
   void SetRunNumber(Int_t run) { fRunNumber = run; }
   Int_t GetRunNumber() const { return fRunNumber; }
@@ -111,8 +115,12 @@ protected:
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, Int_t zDim, TString* selString = 0);
 
+  // add the THnSparse in sources to target
+  static void MergeTHnSparse(THnSparse* target, TObjArray* sources);
+
   // merge THnSparse
   Bool_t fMergeTHnSparseObj;
+  static Bool_t fgSortedTHnSparseMerge; // merge THnSparse by a k-way merge of the sorted bins
   
   // analysis mode
   Int_t fAnalysisMode;  // 0-TPC, 1-TPCITS, 2-Constrained, 3-TPC inner wall, 4-TPC outer wall
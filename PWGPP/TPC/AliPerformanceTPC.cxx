@@ -780,21 +780,29 @@ Long64_t AliPerformanceTPC::Merge(TCollection* const list)
   objArrayList = new TObjArray();
 
   // collection of generated histograms
+  TObjArray clustHistoList;
+  TObjArray eventHistoList;
+  TObjArray trackHistoList;
   Int_t count=0;
   while((obj = iter->Next()) != 0) 
   {
     AliPerformanceTPC* entry = dynamic_cast<AliPerformanceTPC*>(obj);
     if (entry == 0) continue; 
     if (merge) {
-        if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { fTPCClustHisto->Add(entry->fTPCClustHisto); }
-        if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
-        if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { fTPCTrackHisto->Add(entry->fTPCTrackHisto); }
+        if (entry->fTPCClustHisto) { clustHistoList.Add(entry->fTPCClustHisto); }
+        if (entry->fTPCEventHisto) { eventHistoList.Add(entry->fTPCEventHisto); }
+        if (entry->fTPCTrackHisto) { trackHistoList.Add(entry->fTPCTrackHisto); }
     }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
     count++;
   }
+  if (merge) {
+    if (fTPCClustHisto) { MergeTHnSparse(fTPCClustHisto, &clustHistoList); }
+    if (fTPCEventHisto) { MergeTHnSparse(fTPCEventHisto, &eventHistoList); }
+    if (fTPCTrackHisto) { MergeTHnSparse(fTPCTrackHisto, &trackHistoList); }
+  }
   if (fFolderObj) { fFolderObj->Merge(objArrayList); } 
   // to signal that track histos were not merged: reset
   if (!merge) { fTPCTrackHisto->Reset(); fTPCClustHisto->Reset(); fTPCEventHisto->Reset(); }
@@ -15,11 +15,14 @@
 //------------------------------------------------------------------------------
 
 #include <fstream>
+#include <string>
 
 #include "TSystem.h"
 #include "TMath.h"
 #include "TVectorD.h"
 #include "TList.h"
+#include "TObjArray.h"
+#include "TObjString.h"
 #include "TFile.h"
 #include "TGrid.h"
 #include "TF1.h"
@@ -263,12 +266,7 @@ Int_t AliTPCPerformanceSummary::MakeReport(const Char_t* infile, const Char_t* o
         printf("File %s not available\n", infile);
         return -1;
     } 
-    TList* list = 0;
-    list = dynamic_cast<TList*>(f->Get("TPC")); 
-    if (!list) { list = dynamic_cast<TList*>(f->Get("TPCQA")); }
-    if (!list) { list = dynamic_cast<TList*>(f->Get("TPC_PerformanceQA/TPCQA")); }
-    if (!list) { list = dynamic_cast<TList*>(f->Get("TPC_PerformanceQA")); }
-    if (!list) { list = dynamic_cast<TList*>(f->Get("ITSTPCMatch")); }
+    TList* list = GetQAList(f);
     if (!list) {
             printf("QA %s not available\n", infile);
             return -1;
@@ -582,6 +580,153 @@ Int_t AliTPCPerformanceSummary::ProduceTrends(const Char_t* infilelist, const Ch
     return 0;
 }
 
+//_____________________________________________________________________________
+Int_t AliTPCPerformanceSummary::MakeReports(const Char_t* infilelist, const Char_t* outdir, const Char_t* outfile)
+{
+    //
+    // Runs MakeReport for all the QA files of a period and writes the
+    // trending trees of all runs into a single tree in outfile.
+    //
+    // Input: infilelist is a textfile with one QA rootfile per line,
+    // optionally followed by the run number (otherwise taken from the
+    // performance objects).
+    // The report of each input file is kept in outdir and is only made
+    // again if the input file is newer than it, so that re-running over
+    // a period only processes the new or modified runs.
+    // The run number is otherwise read from the performance objects,
+    // files without run number are skipped. If the default OCDB storage
+    // is set, the OCDB run is set before making the report.
+    // A report is only kept if its "trending" tree was written (it is
+    // not written e.g. without GRP entry or TPC in the run), otherwise
+    // the run is processed again at the next call.
+    //
+    
+    if (!infilelist) return -1;
+    if (!outdir) return -1;
+    if (!outfile) return -1;
+    gSystem->mkdir(outdir, kTRUE);
+    
+    ifstream in;
+    in.open(infilelist);
+    if (!in.good()) {
+        printf("File list %s not available\n", infilelist);
+        return -1;
+    }
+    
+    TChain* chain = new TChain("trending");
+    Int_t nMade = 0;
+    Int_t nCached = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        TString currentLine(line.c_str());
+        TObjArray* tokens = currentLine.Tokenize(" \t");
+        if (tokens->GetEntriesFast() < 1) { delete tokens; continue; }
+        TString currentFile = tokens->At(0)->GetName();
+        Int_t run = (tokens->GetEntriesFast() > 1) ? TString(tokens->At(1)->GetName()).Atoi() : -1;
+        delete tokens;
+        if (!currentFile.Contains("root")) continue; // protection
+        
+        TString report = (run > 0) ? Form("%s/TPCPerformanceSummary_%d.root", outdir, run) :
+                                     Form("%s/TPCPerformanceSummary_%u.root", outdir, currentFile.Hash());
+        
+        // the report is up to date if it is newer than the input file
+        FileStat_t inStat, reportStat;
+        Bool_t upToDate = (gSystem->GetPathInfo(report.Data(), reportStat) == 0) &&
+                          (gSystem->GetPathInfo(currentFile.Data(), inStat) == 0) &&
+                          (reportStat.fMtime >= inStat.fMtime);
+        if (upToDate) upToDate = HasTrendingTree(report.Data());
+        if (upToDate) {
+            nCached++;
+        } else {
+            if (run <= 0) run = GetRunNumber(currentFile.Data());
+            if (run <= 0) {
+                printf("Run number of %s not known, skipped\n", currentFile.Data());
+                continue;
+            }
+            if (AliCDBManager::Instance()->IsDefaultStorageSet()) AliCDBManager::Instance()->SetRun(run);
+            // the report is written to a temporary file, renamed only if complete
+            TString tmpReport = report + ".tmp";
+            if (MakeReport(currentFile.Data(), tmpReport.Data(), run) < 0 || !HasTrendingTree(tmpReport.Data())) {
+                printf("No trending tree made for %s\n", currentFile.Data());
+                gSystem->Unlink(tmpReport.Data());
+                continue;
+            }
+            if (gSystem->Rename(tmpReport.Data(), report.Data()) != 0) continue;
+            nMade++;
+        }
+        chain->Add(report.Data());
+    }
+    in.close();
+    ::Info("AliTPCPerformanceSummary::MakeReports","%d reports made, %d reused from %s", nMade, nCached, outdir);
+    
+    TFile* out = new TFile(outfile,"RECREATE");
+    if (!out || out->IsZombie()) { delete out; delete chain; return -1; }
+    out->cd();
+    TTree* tree = (chain->GetNtrees() > 0) ? chain->CopyTree("1") : 0;
+    if (tree) tree->Write();
+    out->Close();
+    delete out;
+    delete chain;
+    return tree ? 0 : -1;
+}
+
+//_____________________________________________________________________________
+TList* AliTPCPerformanceSummary::GetQAList(TFile* f)
+{
+    //
+    // Returns the TList with the TPC performance objects in the QA file f
+    //
+    
+    if (!f) return 0;
+    TList* list = 0;
+    list = dynamic_cast<TList*>(f->Get("TPC")); 
+    if (!list) { list = dynamic_cast<TList*>(f->Get("TPCQA")); }
+    if (!list) { list = dynamic_cast<TList*>(f->Get("TPC_PerformanceQA/TPCQA")); }
+    if (!list) { list = dynamic_cast<TList*>(f->Get("TPC_PerformanceQA")); }
+    if (!list) { list = dynamic_cast<TList*>(f->Get("ITSTPCMatch")); }
+    return list;
+}
+
+//_____________________________________________________________________________
+Int_t AliTPCPerformanceSummary::GetRunNumber(const Char_t* infile)
+{
+    //
+    // Returns the run number stored in the performance objects of the
+    // QA file infile (same precedence as WriteToTTreeSRedirector),
+    // -1 if not available
+    //
+    
+    TFile* f = TFile::Open(infile,"read");
+    if (!f) return -1;
+    Int_t run = -1;
+    TList* list = GetQAList(f);
+    if (list) {
+        AliPerformanceTPC* pTPC = dynamic_cast<AliPerformanceTPC*>(list->FindObject("AliPerformanceTPC"));
+        AliPerformanceDEdx* pTPCgain = dynamic_cast<AliPerformanceDEdx*>(list->FindObject("AliPerformanceDEdxTPCInner"));
+        AliPerformanceMatch* pTPCmatch = dynamic_cast<AliPerformanceMatch*>(list->FindObject("AliPerformanceMatchTPCITS"));
+        if (pTPCmatch) { run = pTPCmatch->GetRunNumber(); }
+        if (pTPCgain) { run = pTPCgain->GetRunNumber(); }
+        if (pTPC) { run = pTPC->GetRunNumber(); }
+    }
+    delete f;
+    return run;
+}
+
+//_____________________________________________________________________________
+Bool_t AliTPCPerformanceSummary::HasTrendingTree(const Char_t* report)
+{
+    //
+    // Checks that the report file contains a filled "trending" tree
+    //
+    
+    TFile* f = TFile::Open(report,"read");
+    if (!f) return kFALSE;
+    TTree* tree = dynamic_cast<TTree*>(f->Get("trending"));
+    Bool_t ok = tree && tree->GetEntries() > 0;
+    delete f;
+    return ok;
+}
+
 //_____________________________________________________________________________
 Int_t AliTPCPerformanceSummary::SaveGraph(TTree* tree, const Char_t* y, const Char_t* x, const Char_t* condition)
 {    
@@ -9,6 +9,8 @@
 //------------------------------------------------------------------------------
 
 class TTree;
+class TFile;
+class TList;
 
 class TTreeSRedirector;
 class AliPerformanceTPC;
@@ -33,6 +35,8 @@ class AliTPCPerformanceSummary
     // the two key functions
     static Int_t MakeReport(const Char_t* infile, const Char_t* outfile, Int_t run);
     static Int_t ProduceTrends(const Char_t* infilelist, const Char_t* outfile);
+    // batch version of MakeReport, reusing the reports of unchanged input files
+    static Int_t MakeReports(const Char_t* infilelist, const Char_t* outdir, const Char_t* outfile);
     
     static Bool_t GetForceTHnSparse() { return fgForceTHnSparse; }
     static void SetForceTHnSparse(Bool_t forceSparse = kTRUE) { fgForceTHnSparse = forceSparse; }      
@@ -43,6 +47,11 @@ class AliTPCPerformanceSummary
     // save graphs to current directory
     
     static Int_t SaveGraph(TTree* tree, const Char_t* y, const Char_t* x, const Char_t* condition);
+
+    // helper functions for MakeReports
+    static TList* GetQAList(TFile* f);
+    static Int_t GetRunNumber(const Char_t* infile);
+    static Bool_t HasTrendingTree(const Char_t* report);
     
     // helper functions to extract parameter and write to TTreeSRedirector
     static Int_t AnalyzeDCARPhi(const AliPerformanceTPC* pTPC, TTreeSRedirector* const pcstream);
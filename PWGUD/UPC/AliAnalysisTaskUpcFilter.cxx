@@ -69,7 +69,8 @@ AliAnalysisTaskUpcFilter::AliAnalysisTaskUpcFilter(const char *name)
  :AliAnalysisTaskSE(name),
   fIsESD(0), fIsMC(0), fFillSPD(0), fMuonCuts(0x0), fTriggerAna(0x0), fCutsList(0x0), fPIDResponse(0x0), fMuonCutsPassName(0x0),
   fHistList(0x0), fCounter(0x0), fTriggerCounter(0x0), fMuonCounter(0x0),
-  fUPCEvent(0x0), fUPCTree(0x0)
+  fUPCEvent(0x0), fUPCTree(0x0),
+  fIdxTrgMask(0), fIdxNtracks(0), fIdxNmuons(0), fIdxCharge(0), fIdxMuonCharge(0)
 {
 
   // Constructor
@@ -241,6 +242,11 @@ void AliAnalysisTaskUpcFilter::UserCreateOutputObjects()
   fUPCTree = new TTree("fUPCTree", "fUPCTree");
   pwd->cd();
   fUPCTree->Branch("fUPCEvent", &fUPCEvent);
+  fUPCTree->Branch("fIdxTrgMask", &fIdxTrgMask, "fIdxTrgMask/l");
+  fUPCTree->Branch("fIdxNtracks", &fIdxNtracks, "fIdxNtracks/I");
+  fUPCTree->Branch("fIdxNmuons", &fIdxNmuons, "fIdxNmuons/I");
+  fUPCTree->Branch("fIdxCharge", &fIdxCharge, "fIdxCharge/I");
+  fUPCTree->Branch("fIdxMuonCharge", &fIdxMuonCharge, "fIdxMuonCharge/I");
 
   PostData(1, fUPCTree);
   PostData(2, fHistList);
@@ -432,6 +438,7 @@ void AliAnalysisTaskUpcFilter::UserExec(Option_t *)
 
   fCounter->Fill( kWritten ); // events written to the tree (ESD and AOD)
 
+  FillIndex();
   fUPCTree ->Fill();
 
   PostData(1, fUPCTree);
@@ -439,6 +446,28 @@ void AliAnalysisTaskUpcFilter::UserExec(Option_t *)
 
 }//UserExec
 
+//_____________________________________________________________________________
+void AliAnalysisTaskUpcFilter::FillIndex()
+{
+  //fill the index branches from the upc event,
+  //they allow AliUPCEventReader to select the events
+  //by trigger class, multiplicity and charge without reading the events
+
+  fIdxTrgMask = 0;
+  for(Int_t itrg=0; itrg<fgkNtrg; itrg++) {
+    if( fUPCEvent->GetTriggerClass(itrg) ) fIdxTrgMask |= (1ULL << itrg);
+  }
+
+  fIdxNtracks = fUPCEvent->GetNumberOfTracks();
+  fIdxCharge = 0;
+  for(Int_t itrk=0; itrk<fIdxNtracks; itrk++) fIdxCharge += fUPCEvent->GetTrack(itrk)->GetCharge();
+
+  fIdxNmuons = fUPCEvent->GetNumberOfMuonTracks();
+  fIdxMuonCharge = 0;
+  for(Int_t imu=0; imu<fIdxNmuons; imu++) fIdxMuonCharge += fUPCEvent->GetMuonTrack(imu)->GetCharge();
+
+}//FillIndex
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisTaskUpcFilter::RunAOD()
 {
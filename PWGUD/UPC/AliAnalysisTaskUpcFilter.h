@@ -33,6 +33,7 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   void RunAODMC(TClonesArray *arrayMC, AliAODMCHeader *headerMC);
   Bool_t RunESD();
   void RunESDMC();
+  void FillIndex();
   virtual void Terminate(Option_t *);
 
  private:
@@ -60,10 +61,17 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   AliUPCEvent *fUPCEvent; // output UPC event
   TTree *fUPCTree; // output tree
 
+  // index branches of the output tree, read by AliUPCEventReader without the full event
+  ULong64_t fIdxTrgMask; // fired trigger classes, bit itrg set for class itrg
+  Int_t fIdxNtracks; // number of central tracks
+  Int_t fIdxNmuons; // number of muon tracks
+  Int_t fIdxCharge; // sum of central track charges
+  Int_t fIdxMuonCharge; // sum of muon track charges
+
   enum EvtCount{ kAna=1, kTrg, kSpecific, kPass1, kPass2, kPassX, kWritten, kAOD, kMunTrack, kCenTrack, kESD, kPidErr };
   enum MuonCount{kMunAll=1, kMunRabs, kMunEta, kMunPDCA};
 
-  ClassDef(AliAnalysisTaskUpcFilter, 1); 
+  ClassDef(AliAnalysisTaskUpcFilter, 2); 
 };
 
 #endif
@@ -0,0 +1,171 @@
+
+//_____________________________________________________________________________
+//    Class for indexed reading of UPC events
+//
+//    The events are selected by trigger class, track multiplicity and
+//    charge using only the index branches written by AliAnalysisTaskUpcFilter
+//    next to the AliUPCEvent branch. Only the selected events are then
+//    read, with the tree cache prefetching the baskets of the selected entries.
+//
+//    Example:
+//      AliUPCEventReader reader(tree);
+//      reader.SetTriggerClass(1);
+//      reader.SetNTracksRange(2, 2);
+//      reader.SetCharge(0);
+//      reader.Select();
+//      while( AliUPCEvent *upcEvent = reader.Next() ) { ... }
+//_____________________________________________________________________________
+
+#include "TTree.h"
+#include "TEntryList.h"
+
+#include "AliUPCEvent.h"
+
+#include "AliUPCEventReader.h"
+
+ClassImp(AliUPCEventReader)
+
+//_____________________________________________________________________________
+AliUPCEventReader::AliUPCEventReader(TTree *tree)
+ :TObject(),
+  fTree(0x0), fUPCEvent(0x0), fEntryList(0x0), fCurrent(0), fEntry(-1), fCacheSize(30000000),
+  fTrgMask(0), fNtracksMin(0), fNtracksMax(-1), fNmuonsMin(0), fNmuonsMax(-1),
+  fUseCharge(kFALSE), fCharge(0), fUseMuonCharge(kFALSE), fMuonCharge(0)
+{
+  // Constructor
+
+  SetTree(tree);
+}
+
+//_____________________________________________________________________________
+AliUPCEventReader::~AliUPCEventReader()
+{
+  // destructor
+
+  if(fTree) {fTree->SetEntryList(0x0); fTree->ResetBranchAddresses();}
+  if(fEntryList) {delete fEntryList; fEntryList = 0x0;}
+  if(fUPCEvent) {delete fUPCEvent; fUPCEvent = 0x0;}
+}
+
+//_____________________________________________________________________________
+void AliUPCEventReader::SetTree(TTree *tree)
+{
+  //set the tree (or chain) written by AliAnalysisTaskUpcFilter,
+  //the previous selection of entries is removed
+
+  if(fTree) {fTree->SetEntryList(0x0); fTree->ResetBranchAddresses();}
+  if(fEntryList) {delete fEntryList; fEntryList = 0x0;}
+
+  fTree = tree;
+  fCurrent = 0;
+  fEntry = -1;
+}
+
+//_____________________________________________________________________________
+void AliUPCEventReader::SetTriggerClass(Int_t idx, Bool_t set)
+{
+  //select events with the trigger class at index 'idx' fired,
+  //events are accepted if any of the selected trigger classes is fired,
+  //all trigger classes are accepted if none is selected
+
+  if(idx < 0 || idx >= AliUPCEvent::fgkNtrg) return;
+
+  if(set) fTrgMask |= (1ULL << idx);
+  else fTrgMask &= ~(1ULL << idx);
+
+}
+
+//_____________________________________________________________________________
+void AliUPCEventReader::ResetSelection(void)
+{
+  //accept all events
+
+  fTrgMask = 0;
+  fNtracksMin = 0; fNtracksMax = -1;
+  fNmuonsMin = 0; fNmuonsMax = -1;
+  fUseCharge = kFALSE; fUseMuonCharge = kFALSE;
+}
+
+//_____________________________________________________________________________
+Long64_t AliUPCEventReader::Select(void)
+{
+  //loop over the index branches and make the list of selected entries,
+  //the events themselves are not read
+  //
+  //returns the number of selected entries, -1 if the tree has no index
+
+  if(!fTree) return -1;
+  if(!fTree->GetBranch("fIdxTrgMask")) {
+    Error("Select", "No index branches in the tree, it was written by an older AliAnalysisTaskUpcFilter");
+    return -1;
+  }
+
+  fTree->SetEntryList(0x0);
+  if(fEntryList) {delete fEntryList; fEntryList = 0x0;}
+
+  ULong64_t trgMask = 0;
+  Int_t ntracks = 0, nmuons = 0, charge = 0, muonCharge = 0;
+
+  fTree->SetBranchStatus("*", 0);
+  fTree->SetBranchStatus("fIdx*", 1);
+  fTree->SetBranchAddress("fIdxTrgMask", &trgMask);
+  fTree->SetBranchAddress("fIdxNtracks", &ntracks);
+  fTree->SetBranchAddress("fIdxNmuons", &nmuons);
+  fTree->SetBranchAddress("fIdxCharge", &charge);
+  fTree->SetBranchAddress("fIdxMuonCharge", &muonCharge);
+
+  fEntryList = new TEntryList("fUPCEntryList", "selected upc events");
+  fEntryList->SetDirectory(0x0);
+
+  Long64_t nentries = fTree->GetEntries();
+  for(Long64_t ientry=0; ientry<nentries; ientry++) {
+    if( fTree->GetEntry(ientry) <= 0 ) continue;
+
+    if( fTrgMask && !(trgMask & fTrgMask) ) continue;
+    if( ntracks < fNtracksMin || (fNtracksMax >= 0 && ntracks > fNtracksMax) ) continue;
+    if( nmuons < fNmuonsMin || (fNmuonsMax >= 0 && nmuons > fNmuonsMax) ) continue;
+    if( fUseCharge && charge != fCharge ) continue;
+    if( fUseMuonCharge && muonCharge != fMuonCharge ) continue;
+
+    fEntryList->Enter(ientry, fTree);
+  }
+
+  //switch back to the events, the cache prefetches only the baskets with selected entries
+  fTree->ResetBranchAddresses();
+  fTree->SetBranchStatus("*", 1);
+  fTree->SetBranchAddress("fUPCEvent", &fUPCEvent);
+  fTree->SetEntryList(fEntryList);
+  if( fCacheSize > 0 ) {
+    fTree->SetCacheSize(fCacheSize);
+    fTree->AddBranchToCache("*", kTRUE);
+    fTree->StopCacheLearningPhase();
+  }
+
+  fCurrent = 0;
+  fEntry = -1;
+
+  return fEntryList->GetN();
+}
+
+//_____________________________________________________________________________
+AliUPCEvent *AliUPCEventReader::Next(void)
+{
+  //read the next selected event, returns 0x0 at the end of the list
+
+  if(!fEntryList || fCurrent >= fEntryList->GetN()) return 0x0;
+
+  fEntry = fTree->GetEntryNumber(fCurrent++);
+  if(fEntry < 0) return 0x0;
+
+  fTree->GetEntry(fEntry);
+
+  return fUPCEvent;
+}
+
+//_____________________________________________________________________________
+Long64_t AliUPCEventReader::GetNSelected(void) const
+{
+  //number of selected entries
+
+  return fEntryList ? fEntryList->GetN() : 0;
+}
@@ -0,0 +1,68 @@
+#ifndef ALIUPCEVENTREADER_H
+#define ALIUPCEVENTREADER_H
+
+//_____________________________________________________________________________
+//    Class for indexed reading of UPC events
+//    written by AliAnalysisTaskUpcFilter
+//_____________________________________________________________________________
+
+#include "TObject.h"
+
+#include "AliUPCEvent.h"
+
+class TTree;
+class TEntryList;
+
+static_assert(AliUPCEvent::fgkNtrg <= 64, "trigger classes do not fit in the ULong64_t index mask");
+
+class AliUPCEventReader : public TObject
+{
+public:
+  AliUPCEventReader(TTree *tree=0x0);
+  virtual ~AliUPCEventReader();
+
+  //selection, applied on the index branches
+  void SetTree(TTree *tree);
+  void SetTriggerClass(Int_t idx, Bool_t set=kTRUE);
+  void SetNTracksRange(Int_t nmin, Int_t nmax) {fNtracksMin=nmin; fNtracksMax=nmax;}
+  void SetNMuonsRange(Int_t nmin, Int_t nmax) {fNmuonsMin=nmin; fNmuonsMax=nmax;}
+  void SetCharge(Int_t charge) {fUseCharge=kTRUE; fCharge=charge;}
+  void SetMuonCharge(Int_t charge) {fUseMuonCharge=kTRUE; fMuonCharge=charge;}
+  void SetCacheSize(Long64_t size) {fCacheSize=size;}
+  void ResetSelection(void);
+
+  Long64_t Select(void);
+  AliUPCEvent *Next(void);
+  void Rewind(void) {fCurrent=0;}
+
+  //Getters
+  Long64_t GetNSelected(void) const;
+  Long64_t GetCurrentEntry(void) const { return fEntry; }
+  AliUPCEvent *GetEvent(void) const { return fUPCEvent; }
+  TEntryList *GetEntryList(void) const { return fEntryList; }
+
+protected:
+  AliUPCEventReader(const AliUPCEventReader &o); // not implemented
+  AliUPCEventReader &operator=(const AliUPCEventReader &o); // not implemented
+
+  TTree *fTree; //! tree (or chain) with the upc events
+  AliUPCEvent *fUPCEvent; //! current upc event
+  TEntryList *fEntryList; //! selected entries
+  Long64_t fCurrent; //! position in the list of selected entries
+  Long64_t fEntry; //! tree entry of the current event
+  Long64_t fCacheSize; // size of the tree cache used to prefetch the selected entries
+
+  ULong64_t fTrgMask; // selected trigger classes, at least one has to be fired
+  Int_t fNtracksMin; // minimal number of central tracks
+  Int_t fNtracksMax; // maximal number of central tracks, no limit if negative
+  Int_t fNmuonsMin; // minimal number of muon tracks
+  Int_t fNmuonsMax; // maximal number of muon tracks, no limit if negative
+  Bool_t fUseCharge; // select on the sum of central track charges
+  Int_t fCharge; // selected sum of central track charges
+  Bool_t fUseMuonCharge; // select on the sum of muon track charges
+  Int_t fMuonCharge; // selected sum of muon track charges
+
+  ClassDef(AliUPCEventReader,2);
+};
+
+#endif
@@ -13,6 +13,7 @@
 #pragma link C++ class AliUPCTrack+;
 #pragma link C++ class AliUPCMuonTrack+;
 #pragma link C++ class AliUPCEvent+;
+#pragma link C++ class AliUPCEventReader+;
 #pragma link C++ class AliAnalysisTaskUpcFilter+;
 #pragma link C++ class AliAODUPCReplicator+;
 #pragma link C++ class AliAnalysisTaskFilterUPCNanoAOD+;
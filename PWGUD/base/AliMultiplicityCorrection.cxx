@@ -785,6 +785,73 @@ void AliMultiplicityCorrection::SetupCurrentHists(Int_t inputRange, Bool_t fullP
   //fCurrentEfficiency->Scale(0.5);
 }
 
+//____________________________________________________________________
+void AliMultiplicityCorrection::FindCorrelationBand(std::vector<Int_t>& first, std::vector<Int_t>& last) const
+{
+  //
+  // finds for each bin i of the generated multiplicity (x axis of fCurrentCorrelation) the range
+  // [first[i], last[i]] of measured multiplicity bins which have a content or an error
+  // as the response is near-diagonal, the loops over the response only need to run over this band
+  // first[i] > last[i] for empty columns
+  //
+
+  Int_t nBinsX = fCurrentCorrelation->GetNbinsX();
+  Int_t nBinsY = fCurrentCorrelation->GetNbinsY();
+  first.assign(nBinsX+2, 1);
+  last.assign(nBinsX+2, 0);
+
+  for (Int_t i=1; i<=nBinsX; ++i)
+  {
+    for (Int_t j=1; j<=nBinsY; ++j)
+    {
+      if (fCurrentCorrelation->GetBinContent(i, j) == 0 && fCurrentCorrelation->GetBinError(i, j) == 0)
+        continue;
+      if (last[i] < first[i])
+        first[i] = j;
+      last[i] = j;
+    }
+  }
+}
+
+//____________________________________________________________________
+void AliMultiplicityCorrection::NormalizeCurrentCorrelation(const std::vector<Int_t>& first, const std::vector<Int_t>& last)
+{
+  //
+  // normalizes each bin of the generated multiplicity of fCurrentCorrelation to the efficiency,
+  // needed for the bayesian method
+  // only the band given by FindCorrelationBand is considered, the cells outside are empty
+  //
+
+  for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
+  {
+    if (last[i] < first[i])
+      continue;
+
+    // with this it is normalized to 1
+    Double_t sum = fCurrentCorrelation->Integral(i, i, first[i], last[i]);
+
+    // with this normalized to the given efficiency
+    if (fCurrentEfficiency->GetBinContent(i) > 0)
+      sum /= fCurrentEfficiency->GetBinContent(i);
+    else
+      sum = 0;
+
+    for (Int_t j=first[i]; j<=last[i]; ++j)
+    {
+      if (sum > 0)
+      {
+        fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
+        fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
+      }
+      else
+      {
+        fCurrentCorrelation->SetBinContent(i, j, 0);
+        fCurrentCorrelation->SetBinError(i, j, 0);
+      }
+    }
+  }
+}
+
 //____________________________________________________________________
 TH1* AliMultiplicityCorrection::GetEfficiency(Int_t inputRange, EventType eventType)
 {
@@ -1480,11 +1547,33 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
   TH1** results = new TH1*[kErrorIterations];
 
+  // the projections are made only once, the response and efficiency (which are modified by the
+  // randomization, the normalization and the unfolding itself) are restored before each iteration.
+  // The response is near-diagonal: only the band of non-empty cells of each column is copied,
+  // randomized and normalized, the other cells stay empty.
+  SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+
+  TH2* correlation = (TH2*) fCurrentCorrelation->Clone("correlationOrig");
+  TH1* efficiency = (TH1*) fCurrentEfficiency->Clone("efficiencyOrig");
+  std::vector<Int_t> bandBegin;
+  std::vector<Int_t> bandEnd;
+  FindCorrelationBand(bandBegin, bandEnd);
+
   for (Int_t n=0; n<kErrorIterations; ++n)
   {
     Printf("Iteration %d of %d...", n, kErrorIterations);
 
-    SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
+    for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
+      for (Int_t j=bandBegin[i]; j<=bandEnd[i]; ++j)
+      {
+        fCurrentCorrelation->SetBinContent(i, j, correlation->GetBinContent(i, j));
+        fCurrentCorrelation->SetBinError(i, j, correlation->GetBinError(i, j));
+      }
+    for (Int_t i=0; i<=fCurrentEfficiency->GetNbinsX()+1; ++i)
+    {
+      fCurrentEfficiency->SetBinContent(i, efficiency->GetBinContent(i));
+      fCurrentEfficiency->SetBinError(i, efficiency->GetBinError(i));
+    }
 
     TH1* measured = (TH1*) fCurrentESD->Clone("measured");
 
@@ -1492,9 +1581,9 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
     {
       if (randomizeResponse)
       {
-        // randomize response matrix
+        // randomize response matrix (the empty cells would stay empty)
         for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-          for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
+          for (Int_t j=bandBegin[i]; j<=bandEnd[i]; ++j)
             fCurrentCorrelation->SetBinContent(i, j, gRandom->Poisson(fCurrentCorrelation->GetBinContent(i, j)));
       }
 
@@ -1512,33 +1601,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
     // only for bayesian method we have to do it before the call to Unfold...
     if (methodType == AliUnfolding::kBayesian)
-    {
-      for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-      {
-        // with this it is normalized to 1
-        Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
-
-        // with this normalized to the given efficiency
-        if (fCurrentEfficiency->GetBinContent(i) > 0)
-          sum /= fCurrentEfficiency->GetBinContent(i);
-        else
-          sum = 0;
-
-        for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-        {
-          if (sum > 0)
-          {
-            fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
-            fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
-          }
-          else
-          {
-            fCurrentCorrelation->SetBinContent(i, j, 0);
-            fCurrentCorrelation->SetBinError(i, j, 0);
-          }
-        }
-      }
-    }
+      NormalizeCurrentCorrelation(bandBegin, bandEnd);
 
     TH1* result = 0;
     if (n == 0 && compareTo)
@@ -1586,6 +1649,9 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
     results[n] = result;
   }
 
+  delete correlation;
+  delete efficiency;
+
   // find covariance matrix
   // results[n] is X_x
   // cov. matrix is M_xy = E ( (X_x - E(X_x)) * (X_y - E(X_y))), with E() = expectation value
@@ -1714,31 +1780,10 @@ void AliMultiplicityCorrection::ApplyBayesianMethod(Int_t inputRange, Bool_t ful
   SetupCurrentHists(inputRange, fullPhaseSpace, eventType);
 
   // normalize correction for given nPart
-  for (Int_t i=1; i<=fCurrentCorrelation->GetNbinsX(); ++i)
-  {
-    // with this it is normalized to 1
-    Double_t sum = fCurrentCorrelation->Integral(i, i, 1, fCurrentCorrelation->GetNbinsY());
-
-    // with this normalized to the given efficiency
-    if (fCurrentEfficiency->GetBinContent(i) > 0)
-      sum /= fCurrentEfficiency->GetBinContent(i);
-    else
-      sum = 0;
-
-    for (Int_t j=1; j<=fCurrentCorrelation->GetNbinsY(); ++j)
-    {
-      if (sum > 0)
-      {
-        fCurrentCorrelation->SetBinContent(i, j, fCurrentCorrelation->GetBinContent(i, j) / sum);
-        fCurrentCorrelation->SetBinError(i, j, fCurrentCorrelation->GetBinError(i, j) / sum);
-      }
-      else
-      {
-        fCurrentCorrelation->SetBinContent(i, j, 0);
-        fCurrentCorrelation->SetBinError(i, j, 0);
-      }
-    }
-  }
+  std::vector<Int_t> bandBegin;
+  std::vector<Int_t> bandEnd;
+  FindCorrelationBand(bandBegin, bandEnd);
+  NormalizeCurrentCorrelation(bandBegin, bandEnd);
 
   Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
 
@@ -3,6 +3,8 @@
 #ifndef ALIMULTIPLICITYCORRECTION_H
 #define ALIMULTIPLICITYCORRECTION_H
 
+#include <vector>
+
 #include "TNamed.h"
 
 //
@@ -119,6 +121,8 @@ class AliMultiplicityCorrection : public TNamed {
 
   protected:
     void SetupCurrentHists(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType);
+    void FindCorrelationBand(std::vector<Int_t>& first, std::vector<Int_t>& last) const;
+    void NormalizeCurrentCorrelation(const std::vector<Int_t>& first, const std::vector<Int_t>& last);
 
     Float_t BayesCovarianceDerivate(Float_t matrixM[251][251], const TH2* hResponse, Int_t k, Int_t i, Int_t r, Int_t u);
     